@@ -30,7 +30,6 @@
 
   #include "config/DGUS_Addr.h"
   #include "config/DGUS_Constants.h"
-  #include "definition/DGUS_VPList.h"
 
   #include "../ui_api.h"
   #include "../../../gcode/gcode.h"
@@ -47,43 +46,317 @@
 
   DGUSDisplay::rx_datagram_state_t DGUSDisplay::rx_datagram_state = DGUS_IDLE;
   uint8_t DGUSDisplay::rx_datagram_len                            = 0;
+  uint8_t DGUSDisplay::rx_ring[DGUS_RX_RING_SIZE + DGUS_RX_TELEGRAM_SIZE];
+  uint16_t DGUSDisplay::rx_head                                   = 0;
+  uint16_t DGUSDisplay::rx_tail                                   = 0;
+  bool DGUSDisplay::rx_busy                                       = false;
+  bool DGUSDisplay::rx_acks_only                                  = false;
 
   bool DGUSDisplay::initialized = false;
 
+  DGUSDisplay::link_stats_t DGUSDisplay::stats = { 0 };
+  millis_t DGUSDisplay::stats_next_ms          = 0;
+  uint32_t DGUSDisplay::stats_tx_bytes         = 0;
+  uint32_t DGUSDisplay::stats_tx_frames        = 0;
+  millis_t DGUSDisplay::rx_idle_ms             = 0;
+
+  // Baudrates tried on startup, LCD_BAUDRATE is used when the display does not answer
+  const uint32_t dgus_baudrates[] PROGMEM = { DGUS_BAUDRATES };
+
+  uint8_t DGUSDisplay::baud_index     = DGUSDisplay::BAUD_SETTLED;
+  uint32_t DGUSDisplay::baudrate      = LCD_BAUDRATE;
+  millis_t DGUSDisplay::baud_probe_ms = 0;
+  millis_t DGUSDisplay::link_probe_ms = 0;
+  uint16_t DGUSDisplay::link_rtt      = 0;
+
+  uint8_t DGUSDisplay::tx_frame[DGUS_HEADER_SIZE + DGUS_TX_FRAME_SIZE + DGUS_CRC_SIZE];
+  uint16_t DGUSDisplay::tx_frame_addr = 0;
+  uint8_t DGUSDisplay::tx_frame_len   = 0;
+  uint8_t DGUSDisplay::tx_batch       = 0;
+
+  #if DGUS_TX_QUEUE_SIZE
+    uint8_t DGUSDisplay::tx_queue[DGUS_TX_QUEUE_SIZE];
+    uint16_t DGUSDisplay::tx_queue_len  = 0;
+    uint16_t DGUSDisplay::tx_queue_sent = 0;
+    bool DGUSDisplay::tx_background     = false;
+  #endif
+
+  DGUSDisplay::read_request_t DGUSDisplay::reads[DGUS_READ_SLOTS];
+
+  DGUSDisplay::control_t DGUSDisplay::controls[DGUS_CONTROL_QUEUE_SIZE];
+  millis_t DGUSDisplay::control_next_ms = 0;
+
+  #if ENABLED(DGUS_CRC)
+    uint16_t DGUSDisplay::tx_crc     = 0;
+    uint16_t DGUSDisplay::crc_errors = 0;
+  #endif
+
+  #if DGUS_ACK_WINDOW
+    uint16_t DGUSDisplay::ack_sent_ms[DGUS_ACK_WINDOW];
+    uint16_t DGUSDisplay::ack_addr[DGUS_ACK_WINDOW];
+    uint8_t DGUSDisplay::ack_len[DGUS_ACK_WINDOW];
+    uint8_t DGUSDisplay::ack_pending   = 0;
+    uint8_t DGUSDisplay::ack_oldest    = 0;
+    bool DGUSDisplay::ack_seen         = false;
+    bool DGUSDisplay::ack_disabled     = false;
+    uint16_t DGUSDisplay::ack_rtt_avg  = 0;
+    uint16_t DGUSDisplay::ack_rtt_max  = 0;
+    uint16_t DGUSDisplay::ack_timeouts = 0;
+  #endif
+
+  #if DGUS_SHADOW_SIZE
+    DGUSDisplay::shadow_t DGUSDisplay::shadow[DGUS_SHADOW_SIZE];
+    uint8_t DGUSDisplay::shadow_next = 0;
+    uint8_t DGUSDisplay::deadband    = 0;
+  #endif
+
   void DGUSDisplay::Loop() {
     ProcessRx();
+    ProcessStats();
+    #if DGUS_TX_QUEUE_SIZE
+      SendQueue(true);
+    #endif
+    ProcessReadTimeouts();
+    ProcessLinkProbe();
+    #if DGUS_ACK_WINDOW
+      ProcessAckTimeouts();
+    #endif
+    ProcessControls();
   }
 
   void DGUSDisplay::Init() {
-    LCD_SERIAL.begin(LCD_BAUDRATE);
+    LOOP_L_N(i, DGUS_CONTROL_QUEUE_SIZE) controls[i].state = 0;
+
+    // Find the baudrate the display is configured for, the answer to the version request tells
+    baud_index    = 0;
+    baud_probe_ms = ExtUI::safe_millis() + DGUS_BAUD_PROBE_TIMEOUT_MS;
+    StartLinkProbe();
+  }
+
+  void DGUSDisplay::ResetLink() {
+    CancelReads();
+    InvalidateShadow();
+    InvalidateControls();
+
+    #if DGUS_ACK_WINDOW
+      ack_pending  = 0;
+      ack_seen     = false;
+      ack_disabled = false;
+      ack_timeouts = 0;
+    #endif
+  }
+
+  void DGUSDisplay::FlushRx() {
+    rx_datagram_state = DGUS_IDLE;
+    rx_tail           = rx_head;
+  }
+
+  void DGUSDisplay::Resync() {
+    ResetLink();
+
+    SetBrightness(brightness);
+    SetVolume(GetVolume());
+  }
+
+  void DGUSDisplay::StartLinkProbe() {
+    baudrate = pgm_read_dword(&dgus_baudrates[baud_index]);
+    DEBUG_ECHOLNPAIR_F("Probing ", baudrate);
+
+    LCD_SERIAL.begin(baudrate);
+    ResetLink();
+    FlushRx(); // Received at the old rate
+
+    link_probe_ms = ExtUI::safe_millis();
+    ReadAsync(DGUS_VERSION, 1, VersionReceived);
+  }
+
+  void DGUSDisplay::VersionReceived(uint16_t addr, const uint8_t *data, uint8_t len) {
+    UNUSED(addr);
+    if (!data || len != 2) return;
 
-    Read(DGUS_VERSION, 1);
+    gui_version = data[0];
+    os_version  = data[1];
+
+    if (IsProbing()) {
+      link_rtt   = ExtUI::safe_millis() - link_probe_ms;
+      baud_index = BAUD_SETTLED;
+      DEBUG_ECHOLNPAIR_F("Link at ", baudrate, " RTT ", link_rtt);
+      ResetLink(); // Anything sent while probing went out at the wrong rate
+    }
+  }
+
+  void DGUSDisplay::ProcessLinkProbe() {
+    if (!IsProbing()) return;
+
+    const millis_t ms = ExtUI::safe_millis();
+    if (PENDING(ms, link_probe_ms + DGUS_BAUD_PROBE_MS)) return;
+
+    if (++baud_index >= COUNT(dgus_baudrates)) {
+      if (ELAPSED(ms, baud_probe_ms)) {
+        // Nothing answered, use the configured rate rather than any unconfirmed one
+        baud_index = BAUD_SETTLED;
+        if (baudrate != LCD_BAUDRATE) {
+          baudrate = LCD_BAUDRATE;
+          LCD_SERIAL.begin(baudrate);
+          ResetLink();
+          FlushRx();
+        }
+        DEBUG_ECHOLNPAIR_F("No answer, using ", baudrate);
+        return;
+      }
+      baud_index = 0; // The display may still be booting, try again
+    }
+
+    StartLinkProbe();
+  }
+
+  void DGUSDisplay::ProcessStats() {
+    const millis_t ms = ExtUI::safe_millis();
+    if (PENDING(ms, stats_next_ms)) return;
+    stats_next_ms = ms + 1000;
+
+    stats.tx_bytes_ps  = _MIN(stats.tx_bytes - stats_tx_bytes, 0xFFFFUL);
+    stats.tx_frames_ps = _MIN(stats.tx_frames - stats_tx_frames, 0xFFFFUL);
+    stats_tx_bytes     = stats.tx_bytes;
+    stats_tx_frames    = stats.tx_frames;
+  }
+
+  void DGUSDisplay::RecordLatency(const millis_t latency) {
+    // Upper limit of each bucket in ms, the last one takes the rest
+    static constexpr uint8_t limits[DGUS_LATENCY_BUCKETS - 1] = { 2, 5, 10, 20, 50, 100, 200 };
+
+    uint8_t bucket = 0;
+    while (bucket < COUNT(limits) && latency > limits[bucket]) bucket++;
+
+    if (stats.latency[bucket] < 0xFFFF) stats.latency[bucket]++;
+  }
+
+  void DGUSDisplay::DumpStats() {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("DGUS TX ", stats.tx_bytes, " bytes ", stats.tx_frames, " frames, ",
+                      stats.tx_bytes_ps, " bytes/s ", stats.tx_frames_ps, " frames/s");
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("DGUS RX ", stats.rx_datagrams, " datagrams, ", stats.unknown_vp, " unknown VP, ",
+                      stats.size_mismatch, " size mismatch, ", stats.overruns, " overruns");
+    #if ENABLED(DGUS_CRC)
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPAIR("DGUS CRC errors ", crc_errors);
+    #endif
+    #if DGUS_ACK_WINDOW
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPAIR("DGUS ACK RTT ", ack_rtt_avg, " ms, max ", ack_rtt_max, " ms, ", ack_timeouts, " timeouts");
+    #endif
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM("DGUS latency (<=2/5/10/20/50/100/200/more ms)");
+    LOOP_L_N(i, DGUS_LATENCY_BUCKETS) SERIAL_ECHOPAIR(" ", stats.latency[i]);
+    SERIAL_EOL();
+  }
+
+  uint32_t DGUSDisplay::GetBaudrate() {
+    return baudrate;
+  }
+
+  uint16_t DGUSDisplay::GetLinkRtt() {
+    return link_rtt;
   }
 
   void DGUSDisplay::Read(uint16_t addr, uint8_t size) {
-    WriteHeader(addr, DGUS_READVAR, size);
+    FlushFrame();
+    WriteHeader(addr, DGUS_READVAR, 1);
+    TxByte(size);
+    WriteFooter();
+  }
+
+  bool DGUSDisplay::ReadAsync(uint16_t addr, uint8_t words, read_callback_t callback) {
+    if (!callback) return false;
 
-    LCD_SERIAL.write(size);
+    LOOP_L_N(i, DGUS_READ_SLOTS) {
+      read_request_t &r = reads[i];
+      if (r.callback) continue;
+
+      r.addr     = addr;
+      r.words    = words;
+      r.callback = callback;
+      r.timeout  = ExtUI::safe_millis() + DGUS_READ_TIMEOUT_MS;
+
+      Read(addr, words);
+      return true;
+    }
+
+    DEBUG_ECHOLNPGM("No free read slot");
+    return false;
+  }
+
+  bool DGUSDisplay::ReadReceived(uint16_t addr, const uint8_t *data, uint8_t len) {
+    LOOP_L_N(i, DGUS_READ_SLOTS) {
+      read_request_t &r = reads[i];
+      if (!r.callback || r.addr != addr || r.words << 1 != len) continue;
+
+      // Free the slot first, the callback may start a new read
+      const read_callback_t callback = r.callback;
+      r.callback = nullptr;
+      callback(addr, data, len);
+      return true;
+    }
+    return false;
+  }
+
+  void DGUSDisplay::ProcessReadTimeouts() {
+    const millis_t ms = ExtUI::safe_millis();
+
+    LOOP_L_N(i, DGUS_READ_SLOTS) {
+      read_request_t &r = reads[i];
+      if (!r.callback || PENDING(ms, r.timeout)) continue;
+
+      DEBUG_ECHOLNPAIR_F("Read timeout ", r.addr);
+      const read_callback_t callback = r.callback;
+      r.callback = nullptr;
+      callback(r.addr, nullptr, 0);
+    }
+  }
+
+  void DGUSDisplay::CancelReads() {
+    LOOP_L_N(i, DGUS_READ_SLOTS) reads[i].callback = nullptr;
   }
 
   void DGUSDisplay::Write(uint16_t addr, const void *data_ptr, uint8_t size) {
     if (!data_ptr) return;
 
-    WriteHeader(addr, DGUS_WRITEVAR, size);
+    #if DGUS_SHADOW_SIZE
+      if (ShadowMatch(addr, data_ptr, size)) return;
+    #endif
 
     const char *data = static_cast<const char *>(data_ptr);
+    uint8_t *frame   = StageWrite(addr, size);
 
-    while (size--)
-      LCD_SERIAL.write(*data++);
+    if (frame) {
+      memcpy(frame, data, size);
+      if (!tx_batch) FlushFrame();
+      return;
+    }
+
+    // Too large for the frame buffer, send it directly.
+    WriteHeader(addr, DGUS_WRITEVAR, size);
+    TxPayload(data, size);
+    WriteFooter();
   }
 
   void DGUSDisplay::WriteString(uint16_t addr, const void *data_ptr, uint8_t size, bool left, bool right, bool use_space) {
-    if (!data_ptr) return;
+    WriteString(addr, string_source_t{ static_cast<const char *>(data_ptr), false }, size, left, right, use_space);
+  }
 
-    WriteHeader(addr, DGUS_WRITEVAR, size);
+  void DGUSDisplay::WriteStringPGM(uint16_t addr, const void *data_ptr, uint8_t size, bool left, bool right, bool use_space) {
+    WriteString(addr, string_source_t{ static_cast<const char *>(data_ptr), true }, size, left, right, use_space);
+  }
 
-    const char *data     = static_cast<const char *>(data_ptr);
-    size_t len           = strlen(data);
+  void DGUSDisplay::WriteString(uint16_t addr, FSTR_P const fstr, uint8_t size, bool left, bool right, bool use_space) {
+    WriteString(addr, string_source_t{ FTOP(fstr), true }, size, left, right, use_space);
+  }
+
+  void DGUSDisplay::WriteString(uint16_t addr, const string_source_t &str, uint8_t size, bool left, bool right, bool use_space) {
+    if (!str.data) return;
+
+    size_t len           = str.pgm ? strlen_P(str.data) : strlen(str.data);
     uint8_t left_spaces  = 0;
     uint8_t right_spaces = 0;
 
@@ -106,49 +379,60 @@
       len = size;
     }
 
-    while (left_spaces--)
-      LCD_SERIAL.write(' ');
-    while (len--)
-      LCD_SERIAL.write(*data++);
-    while (right_spaces--)
-      LCD_SERIAL.write(use_space ? ' ' : '\0');
-  }
+    const uint8_t padding = use_space ? ' ' : '\0';
+    uint8_t *frame        = StageWrite(addr, size);
 
-  void DGUSDisplay::WriteStringPGM(uint16_t addr, const void *data_ptr, uint8_t size, bool left, bool right, bool use_space) {
-    if (!data_ptr) return;
+    if (frame) {
+      memset(frame, ' ', left_spaces);
+      str.CopyTo(frame + left_spaces, len);
+      memset(frame + left_spaces + len, padding, right_spaces);
+
+      #if DGUS_SHADOW_SIZE
+        if (ShadowMatch(addr, frame, size)) {
+          tx_frame_len -= size; // Unchanged, take it back out of the frame
+          return;
+        }
+      #endif
+
+      if (!tx_batch) FlushFrame();
+      return;
+    }
 
+    // Too large for the frame buffer, send it directly in chunks
     WriteHeader(addr, DGUS_WRITEVAR, size);
 
-    const char *data     = static_cast<const char *>(data_ptr);
-    size_t len           = strlen_P(data);
-    uint8_t left_spaces  = 0;
-    uint8_t right_spaces = 0;
+    uint8_t chunk[16];
+    memset(chunk, ' ', sizeof(chunk));
+    while (left_spaces) {
+      const uint8_t n = _MIN(left_spaces, sizeof(chunk));
+      TxPayload(chunk, n);
+      left_spaces -= n;
+    }
 
-    if (len < size) {
-      if (!len) {
-        right_spaces = size;
-      }
-      else if ((left && right) || (!left && !right)) {
-        left_spaces  = (size - len) / 2;
-        right_spaces = size - len - left_spaces;
-      }
-      else if (left) {
-        right_spaces = size - len;
-      }
-      else {
-        left_spaces = size - len;
-      }
+    for (uint8_t pos = 0; pos < len;) {
+      const uint8_t n = _MIN(len - pos, sizeof(chunk));
+      str.CopyTo(chunk, n, pos);
+      TxPayload(chunk, n);
+      pos += n;
     }
-    else {
-      len = size;
+
+    memset(chunk, padding, sizeof(chunk));
+    while (right_spaces) {
+      const uint8_t n = _MIN(right_spaces, sizeof(chunk));
+      TxPayload(chunk, n);
+      right_spaces -= n;
     }
 
-    while (left_spaces--)
-      LCD_SERIAL.write(' ');
-    while (len--)
-      LCD_SERIAL.write(pgm_read_byte(data++));
-    while (right_spaces--)
-      LCD_SERIAL.write(use_space ? ' ' : '\0');
+    WriteFooter();
+  }
+
+  void DGUSDisplay::StartBatch() {
+    tx_batch++;
+  }
+
+  void DGUSDisplay::EndBatch() {
+    if (tx_batch && --tx_batch) return;
+    FlushFrame();
   }
 
   void DGUSDisplay::SwitchScreen(DGUS_Screen screen) {
@@ -167,22 +451,42 @@
 
   void DGUSDisplay::EnableControl(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control) {
     DEBUG_ECHOLNPAIR_F("EnableControl ", (uint8_t)control, "\nScreen ", (uint8_t)screen, "\nType ", (uint8_t)type);
-
-    const uint8_t command[] = { 0x5A, 0xA5, 0x00, (uint8_t)screen, (uint8_t)control, type, 0x00, 0x01 };
-    Write(0xB0, command, sizeof(command));
-
-    FlushTx();
-    delay(50);
+    SetControlState(screen, type, control, true);
   }
 
   void DGUSDisplay::DisableControl(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control) {
     DEBUG_ECHOLNPAIR_F("DisableControl ", (uint8_t)control, "\nScreen ", (uint8_t)screen, "\nType ", (uint8_t)type);
+    SetControlState(screen, type, control, false);
+  }
 
-    const uint8_t command[] = { 0x5A, 0xA5, 0x00, (uint8_t)screen, (uint8_t)control, type, 0x00, 0x00 };
-    Write(0xB0, command, sizeof(command));
+  void DGUSDisplay::InvalidateControls() {
+    // Keep the wanted states, but send all of them again
+    LOOP_L_N(i, DGUS_CONTROL_QUEUE_SIZE) CBI(controls[i].state, CONTROL_KNOWN);
+  }
+
+  void DGUSDisplay::InvalidateShadow() {
+    #if DGUS_SHADOW_SIZE
+      LOOP_L_N(i, DGUS_SHADOW_SIZE) shadow[i].size = 0;
+      shadow_next = 0;
+    #endif
+  }
+
+  void DGUSDisplay::InvalidateShadow(uint16_t addr, uint8_t words) {
+    #if DGUS_SHADOW_SIZE
+      LOOP_L_N(i, DGUS_SHADOW_SIZE)
+        if (shadow[i].size && shadow[i].addr >= addr && shadow[i].addr < addr + words) shadow[i].size = 0;
+    #else
+      UNUSED(addr);
+      UNUSED(words);
+    #endif
+  }
 
-    FlushTx();
-    delay(50);
+  void DGUSDisplay::SetDeadband(uint8_t new_deadband) {
+    #if DGUS_SHADOW_SIZE
+      deadband = new_deadband;
+    #else
+      UNUSED(new_deadband);
+    #endif
   }
 
   uint8_t DGUSDisplay::GetBrightness() {
@@ -209,159 +513,232 @@
   }
 
   void DGUSDisplay::ProcessRx() {
+    // Handlers get pointers into the ring. One that gets back here, e.g. through idle(),
+    // must not have them overwritten, so the ring is left alone until it returns.
+    if (rx_busy) return;
+
+    rx_busy = true;
+    ReceiveDatagrams();
+    rx_busy = false;
+  }
+
+  void DGUSDisplay::ReceiveDatagrams() {
 
     #if ENABLED(LCD_SERIAL_STATS_RX_BUFFER_OVERRUNS)
       if (!LCD_SERIAL.available() && LCD_SERIAL.buffer_overruns()) {
         // Overrun, but reset the flag only when the buffer is empty
         // We want to extract as many as valid datagrams possible...
         DEBUG_ECHOPGM("OVFL");
+        stats.overruns++;
         rx_datagram_state = DGUS_IDLE;
+        rx_tail           = rx_head;
         // LCD_SERIAL.reset_rx_overun();
         LCD_SERIAL.flush();
       }
     #endif
 
+    // Move what the serial driver received into the ring
+    while (RxUsed() < DGUS_RX_RING_SIZE - 1 && LCD_SERIAL.available()) {
+      rx_ring[rx_head] = LCD_SERIAL.read();
+      rx_head          = (rx_head + 1) & (DGUS_RX_RING_SIZE - 1);
+    }
+
     uint8_t receivedbyte;
-    while (LCD_SERIAL.available())
+    uint8_t budget = DGUS_RX_BUDGET; // Datagrams handled per call, the rest waits in the ring
+    while (budget && RxUsed())
       switch (rx_datagram_state) {
 
         case DGUS_IDLE: // Waiting for the first header byte
-          receivedbyte = LCD_SERIAL.read();
+          receivedbyte = RxByte();
           DEBUG_ECHOPAIR_F("< ", receivedbyte);
           if (DGUS_HEADER1 == receivedbyte) rx_datagram_state = DGUS_HEADER1_SEEN;
           break;
 
         case DGUS_HEADER1_SEEN: // Waiting for the second header byte
-          receivedbyte = LCD_SERIAL.read();
+          receivedbyte = RxByte();
           DEBUG_ECHOPAIR_F(" ", receivedbyte);
           rx_datagram_state = (DGUS_HEADER2 == receivedbyte) ? DGUS_HEADER2_SEEN : DGUS_IDLE;
           break;
 
         case DGUS_HEADER2_SEEN: // Waiting for the length byte
-          rx_datagram_len = LCD_SERIAL.read();
+          rx_datagram_len = RxByte();
           DEBUG_ECHOPAIR_F(" (", rx_datagram_len, ") ");
 
           // Telegram min len is 3 (command and one word of payload)
-          rx_datagram_state = WITHIN(rx_datagram_len, 3, DGUS_RX_BUFFER_SIZE) ? DGUS_WAIT_TELEGRAM : DGUS_IDLE;
+          rx_datagram_state = WITHIN(rx_datagram_len, 3 + DGUS_CRC_SIZE, DGUS_RX_TELEGRAM_SIZE) ? DGUS_WAIT_TELEGRAM : DGUS_IDLE;
           break;
 
-        case DGUS_WAIT_TELEGRAM: // wait for complete datagram to arrive.
-          if (LCD_SERIAL.available() < rx_datagram_len) return;
+        case DGUS_WAIT_TELEGRAM: { // wait for complete datagram to arrive.
+          if (RxUsed() < rx_datagram_len) return;
 
           initialized = true;    // We've talked to it, so we defined it as initialized.
-          uint8_t command = LCD_SERIAL.read();
-
-          DEBUG_ECHOPAIR_F("# ", command);
-
-          uint8_t readlen = rx_datagram_len - 1; // command is part of len.
-          unsigned char tmp[rx_datagram_len - 1];
-          unsigned char *ptmp = tmp;
-
-          while (readlen--) {
-            receivedbyte = LCD_SERIAL.read();
-            DEBUG_ECHOPAIR_F(" ", receivedbyte);
-            *ptmp++ = receivedbyte;
-          }
-          DEBUG_ECHOPGM(" # ");
-          // mostly we'll get this: 5A A5 03 82 4F 4B -- ACK on 0x82, so discard it.
-          if (command == DGUS_WRITEVAR && 'O' == tmp[0] && 'K' == tmp[1]) {
-            DEBUG_ECHOLNPGM(">");
-            rx_datagram_state = DGUS_IDLE;
-            break;
-          }
-
-          /* AutoUpload, (and answer to) Command 0x83 :
-            |      tmp[0  1  2  3  4 ... ]
-            | Example 5A A5 06 83 20 01 01 78 01 ……
-            |          / /  |  |   \ /   |  \     \
-            |        Header |  |    |    |   \_____\_ DATA (Words!)
-            |     DatagramLen  /  VPAdr  |
-            |           Command          DataLen (in Words) */
-          if (command == DGUS_READVAR) {
-            const uint16_t addr = tmp[0] << 8 | tmp[1];
-            const uint8_t dlen  = tmp[2] << 1; // Convert to Bytes. (Display works with words)
-            DEBUG_ECHOPAIR_F("addr=", addr, " dlen=", dlen, "> ");
-
-            if (addr == DGUS_VERSION && dlen == 2) {
-              DEBUG_ECHOLNPGM("VERSIONS");
-              gui_version       = tmp[3];
-              os_version        = tmp[4];
-              rx_datagram_state = DGUS_IDLE;
-              break;
-            }
 
-            DGUS_VP vp;
-            if (!DGUS_PopulateVP((DGUS_Addr)addr, &vp)) {
-              DEBUG_ECHOLNPGM("VP not found");
-              rx_datagram_state = DGUS_IDLE;
-              break;
-            }
+          // The telegram is handled in place. A part that wrapped around is mirrored behind the ring.
+          uint8_t *const telegram = &rx_ring[rx_tail];
+          if (rx_tail + rx_datagram_len > DGUS_RX_RING_SIZE)
+            memcpy(&rx_ring[DGUS_RX_RING_SIZE], rx_ring, rx_tail + rx_datagram_len - DGUS_RX_RING_SIZE);
+
+          rx_tail           = (rx_tail + rx_datagram_len) & (DGUS_RX_RING_SIZE - 1);
+          rx_datagram_state = DGUS_IDLE;
 
-            if (!vp.rx_handler) {
-              DEBUG_ECHOLNPGM("VP found, no handler.");
-              rx_datagram_state = DGUS_IDLE;
+          #if ENABLED(DGUS_CRC)
+            const uint8_t crc_pos = rx_datagram_len - DGUS_CRC_SIZE;
+            if (CRC16(telegram, crc_pos) != (telegram[crc_pos] | telegram[crc_pos + 1] << 8)) {
+              crc_errors++;
+              DEBUG_ECHOLNPGM("CRC error");
               break;
             }
+          #endif
 
-            gcode.reset_stepper_timeout();
+          stats.rx_datagrams++;
+          if (ProcessDatagram(telegram[0], &telegram[1], rx_datagram_len - 1 - DGUS_CRC_SIZE))
+            budget--;
+          break;
+        }
+      }
 
-            if (!vp.size) {
-              DEBUG_ECHOLN();
-              vp.rx_handler(vp, nullptr);
+    // Everything received so far is handled
+    if (!RxUsed() && !LCD_SERIAL.available())
+      rx_idle_ms = ExtUI::safe_millis();
+  }
 
-              rx_datagram_state = DGUS_IDLE;
-              break;
-            }
+  bool DGUSDisplay::ProcessDatagram(uint8_t command, uint8_t *data, uint8_t len) {
+    DEBUG_ECHOPAIR_F("# ", command);
+    #if DEBUG_OUT
+      LOOP_L_N(i, len) DEBUG_ECHOPAIR_F(" ", data[i]);
+    #endif
+    DEBUG_ECHOPGM(" # ");
+
+    // mostly we'll get this: 5A A5 03 82 4F 4B -- ACK on 0x82, so discard it.
+    if (command == DGUS_WRITEVAR && 'O' == data[0] && 'K' == data[1]) {
+      DEBUG_ECHOLNPGM(">");
+      #if DGUS_ACK_WINDOW
+        AckReceived();
+      #endif
+      return false;
+    }
 
-            if (vp.flags & VPFLAG_RXSTRING) {
-              unsigned char buffer[vp.size];
-              memset(buffer, 0, vp.size);
+    if (rx_acks_only) {
+      DEBUG_ECHOLNPGM(">");
+      return true;
+    }
 
-              for (uint8_t i = 0; i < dlen; i++) {
-                if (i >= vp.size)
-                  break;
+    /* AutoUpload, (and answer to) Command 0x83 :
+      |     data[0  1  2  3  4 ... ]
+      | Example 5A A5 06 83 20 01 01 78 01 ……
+      |          / /  |  |   \ /   |  \     \
+      |        Header |  |    |    |   \_____\_ DATA (Words!)
+      |     DatagramLen  /  VPAdr  |
+      |           Command          DataLen (in Words) */
+    if (command != DGUS_READVAR || len < 3) {
+      DEBUG_ECHOLNPGM(">");
+      return true;
+    }
 
-                if (i + 1 < dlen && tmp[i + 3] == 0xFF && tmp[i + 4] == 0xFF)
-                  break;
+    const uint16_t addr = data[0] << 8 | data[1];
+    const uint8_t dlen  = data[2] << 1; // Convert to Bytes. (Display works with words)
+    DEBUG_ECHOPAIR_F("addr=", addr, " dlen=", dlen, "> ");
 
-                buffer[i] = tmp[i + 3];
-              }
+    if (dlen > len - 3) {
+      DEBUG_ECHOLNPGM("Datagram too short");
+      return true;
+    }
 
-              DEBUG_ECHOLN();
-              vp.rx_handler(vp, buffer);
+    if (ReadReceived(addr, &data[3], dlen)) {
+      DEBUG_ECHOLNPGM("Read answer");
+      return true;
+    }
 
-              rx_datagram_state = DGUS_IDLE;
-              break;
-            }
+    DGUS_VP vp;
+    if (!DGUS_PopulateVP((DGUS_Addr)addr, &vp)) {
+      DEBUG_ECHOLNPGM("VP not found");
+      stats.unknown_vp++;
+      return true;
+    }
 
-            if (dlen != vp.size) {
-              DEBUG_ECHOLNPGM("VP found, size mismatch.");
-              rx_datagram_state = DGUS_IDLE;
-              break;
-            }
+    if (!vp.rx_handler) {
+      DEBUG_ECHOLNPGM("VP found, no handler.");
+      return true;
+    }
 
-            DEBUG_ECHOLN();
-            vp.rx_handler(vp, &tmp[3]);
+    gcode.reset_stepper_timeout();
 
-            rx_datagram_state = DGUS_IDLE;
-            break;
-          }
+    // The datagram arrived at most this long ago
+    RecordLatency(ExtUI::safe_millis() - rx_idle_ms);
 
-          DEBUG_ECHOLNPGM(">");
-          rx_datagram_state = DGUS_IDLE;
+    // The display changed the value itself, so our copy is stale
+    InvalidateShadow(addr);
+
+    if (!vp.size) {
+      DEBUG_ECHOLN();
+      vp.rx_handler(vp, nullptr);
+      return true;
+    }
+
+    if (vp.flags & VPFLAG_RXSTRING) {
+      // Hand over the received characters up to the 0xFFFF terminator; vp.size becomes their count
+      uint8_t i = 0;
+      for (; i < dlen && i < vp.size; i++) {
+        if (i + 1 < dlen && data[i + 3] == 0xFF && data[i + 4] == 0xFF)
           break;
       }
+      vp.size = i;
+
+      DEBUG_ECHOLN();
+      vp.rx_handler(vp, &data[3]);
+      return true;
+    }
+
+    if (dlen != vp.size) {
+      DEBUG_ECHOLNPGM("VP found, size mismatch.");
+      stats.size_mismatch++;
+      return true;
+    }
+
+    DEBUG_ECHOLN();
+    vp.rx_handler(vp, &data[3]);
+    return true;
   }
 
   size_t DGUSDisplay::GetFreeTxBuffer() {
+    #if DGUS_TX_QUEUE_SIZE
+      // Background frames wait in the queue, not in the serial buffer
+      if (tx_background)
+        return DGUS_TX_QUEUE_SIZE - (tx_queue_len - tx_queue_sent);
+    #endif
+
+    return GetFreeSerialTx();
+  }
+
+  size_t DGUSDisplay::GetFreeSerialTx() {
+    #if DGUS_ACK_WINDOW
+      // The display still has to process a full window of writes
+      if (ack_pending >= DGUS_ACK_WINDOW) return 0;
+    #endif
+
     #ifdef LCD_SERIAL_GET_TX_BUFFER_FREE
       return LCD_SERIAL_GET_TX_BUFFER_FREE();
+    #elif defined(ARDUINO_ARCH_STM32)
+      return LCD_SERIAL.availableForWrite();
     #else
       return SIZE_MAX;
     #endif
   }
 
+  void DGUSDisplay::ProcessAcksOnly() {
+    rx_acks_only = true;
+    ProcessRx();
+    #if DGUS_ACK_WINDOW
+      ProcessAckTimeouts();
+    #endif
+  }
+
   void DGUSDisplay::FlushTx() {
+    FlushFrame();
+    #if DGUS_TX_QUEUE_SIZE
+      SendQueue(false);
+    #endif
+
     #ifdef ARDUINO_ARCH_STM32
       LCD_SERIAL.flush();
     #else
@@ -369,28 +746,369 @@
     #endif
   }
 
+  #if DGUS_ACK_WINDOW
+
+    uint16_t DGUSDisplay::GetAckRtt() {
+      return ack_rtt_avg;
+    }
+
+    uint16_t DGUSDisplay::GetAckTimeouts() {
+      return ack_timeouts;
+    }
+
+    void DGUSDisplay::AckExpected(uint16_t addr, uint8_t len) {
+      if (ack_disabled) return;
+
+      // Overrunning the window forgets the oldest write
+      if (ack_pending == DGUS_ACK_WINDOW) AckDone(false);
+
+      const uint8_t slot = (ack_oldest + ack_pending) % DGUS_ACK_WINDOW;
+      ack_sent_ms[slot] = (uint16_t)ExtUI::safe_millis();
+      ack_addr[slot]    = addr;
+      ack_len[slot]     = len;
+      ack_pending++;
+    }
+
+    void DGUSDisplay::AckDone(bool acknowledged) {
+      if (!acknowledged) InvalidateShadow(ack_addr[ack_oldest], (ack_len[ack_oldest] + 1) / 2);
+
+      ack_oldest = (ack_oldest + 1) % DGUS_ACK_WINDOW;
+      ack_pending--;
+    }
+
+    void DGUSDisplay::AckReceived() {
+      ack_seen = true;
+      if (!ack_pending) return;
+
+      const uint16_t rtt = (uint16_t)ExtUI::safe_millis() - ack_sent_ms[ack_oldest];
+      AckDone(true);
+
+      // Moving average over about 8 ACKs
+      ack_rtt_avg = ack_rtt_avg ? ack_rtt_avg - (ack_rtt_avg >> 3) + (rtt >> 3) : rtt;
+      NOLESS(ack_rtt_max, rtt);
+    }
+
+    void DGUSDisplay::ProcessAckTimeouts() {
+      if (!ack_pending) return;
+      if ((uint16_t)((uint16_t)ExtUI::safe_millis() - ack_sent_ms[ack_oldest]) < DGUS_ACK_TIMEOUT_MS) return;
+
+      AckDone(false);
+      ack_timeouts++;
+      DEBUG_ECHOLNPAIR_F("ACK timeout ", ack_timeouts);
+
+      // Not every display configuration acknowledges writes; stop waiting for them
+      if (!ack_seen && ack_timeouts >= DGUS_ACK_WINDOW) {
+        DEBUG_ECHOLNPGM("No ACKs, flow control disabled");
+        ack_disabled = true;
+        while (ack_pending) AckDone(false);
+      }
+    }
+
+  #endif // DGUS_ACK_WINDOW
+
+  // Modbus CRC16 (polynomial 0xA001 reflected, initial value 0xFFFF), one table entry per byte value
+  struct DGUS_CRCTable { uint16_t value[256]; };
+
+  constexpr DGUS_CRCTable DGUS_BuildCRCTable() {
+    DGUS_CRCTable table = {};
+    for (uint16_t i = 0; i < 256; i++) {
+      uint16_t crc = i;
+      for (uint8_t bit = 0; bit < 8; bit++)
+        crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+      table.value[i] = crc;
+    }
+    return table;
+  }
+
+  const DGUS_CRCTable crc_table PROGMEM = DGUS_BuildCRCTable();
+
+  uint16_t DGUSDisplay::CRC16(const uint8_t *data, uint8_t len, uint16_t crc) {
+    while (len--)
+      crc = (crc >> 8) ^ pgm_read_word(&crc_table.value[(crc ^ *data++) & 0xFF]);
+    return crc;
+  }
+
+  #if ENABLED(DGUS_CRC)
+
+    uint16_t DGUSDisplay::GetCRCErrors() {
+      return crc_errors;
+    }
+
+  #endif // DGUS_CRC
+
   void DGUSDisplay::WriteHeader(uint16_t addr, uint8_t command, uint8_t len) {
-    LCD_SERIAL.write(DGUS_HEADER1);
-    LCD_SERIAL.write(DGUS_HEADER2);
-    LCD_SERIAL.write(len + 3);
-    LCD_SERIAL.write(command);
-    LCD_SERIAL.write(addr >> 8);
-    LCD_SERIAL.write(addr & 0xFF);
-  }
-
-  bool DGUS_PopulateVP(const DGUS_Addr addr, DGUS_VP *const buffer) {
-    const DGUS_VP *ret = vp_list;
-
-    do {
-      const uint16_t addrcheck = pgm_read_word(&ret->addr);
-      if (addrcheck == 0) break;
-      if ((DGUS_Addr)addrcheck == addr) {
-        memcpy_P(buffer, ret, sizeof(*ret));
-        return true;
+    #if DGUS_TX_QUEUE_SIZE
+      // Rare oversized writes keep their order with everything queued
+      if (command == DGUS_WRITEVAR) SendQueue(false);
+    #endif
+
+    #if DGUS_ACK_WINDOW
+      if (command == DGUS_WRITEVAR) AckExpected(addr, len);
+    #endif
+
+    uint8_t header[DGUS_HEADER_SIZE];
+    BuildHeader(header, addr, command, len);
+    LCD_SERIAL.write(header, sizeof(header));
+
+    stats.tx_frames++;
+    stats.tx_bytes += sizeof(header);
+
+    #if ENABLED(DGUS_CRC)
+      tx_crc = CRC16(&header[3], DGUS_HEADER_SIZE - 3); // The CRC covers the command and everything after it
+    #endif
+  }
+
+  void DGUSDisplay::TxPayload(const void *data_ptr, uint8_t len) {
+    const uint8_t *data = static_cast<const uint8_t *>(data_ptr);
+    LCD_SERIAL.write(data, len);
+    stats.tx_bytes += len;
+
+    #if ENABLED(DGUS_CRC)
+      tx_crc = CRC16(data, len, tx_crc);
+    #endif
+  }
+
+  void DGUSDisplay::TxByte(uint8_t value) {
+    TxPayload(&value, 1);
+  }
+
+  void DGUSDisplay::WriteFooter() {
+    #if ENABLED(DGUS_CRC)
+      const uint8_t crc[] = { uint8_t(tx_crc & 0xFF), uint8_t(tx_crc >> 8) };
+      LCD_SERIAL.write(crc, sizeof(crc));
+      stats.tx_bytes += sizeof(crc);
+    #endif
+  }
+
+  void DGUSDisplay::BuildHeader(uint8_t *header, uint16_t addr, uint8_t command, uint8_t len) {
+    header[0] = DGUS_HEADER1;
+    header[1] = DGUS_HEADER2;
+    header[2] = len + 3 + DGUS_CRC_SIZE;
+    header[3] = command;
+    header[4] = addr >> 8;
+    header[5] = addr & 0xFF;
+  }
+
+  uint8_t* DGUSDisplay::StageWrite(uint16_t addr, uint8_t size) {
+    // Append to the pending frame if the write continues its address range.
+    // The display addresses words, so an odd-sized frame cannot be extended.
+    if (!tx_frame_len
+        || (tx_frame_len & 1)
+        || addr != tx_frame_addr + tx_frame_len / 2
+        || tx_frame_len + size > DGUS_TX_FRAME_SIZE
+        ) {
+      FlushFrame();
+      if (size > DGUS_TX_FRAME_SIZE) return nullptr;
+      tx_frame_addr = addr;
+    }
+
+    uint8_t *frame = &tx_frame[DGUS_HEADER_SIZE + tx_frame_len];
+    tx_frame_len += size;
+    return frame;
+  }
+
+  void DGUSDisplay::FlushFrame() {
+    if (!tx_frame_len) return;
+
+    // The header goes in front of the staged data so the serial driver gets the frame in one piece
+    BuildHeader(tx_frame, tx_frame_addr, DGUS_WRITEVAR, tx_frame_len);
+
+    #if ENABLED(DGUS_CRC)
+      const uint16_t crc = CRC16(&tx_frame[3], DGUS_HEADER_SIZE - 3 + tx_frame_len);
+      tx_frame[DGUS_HEADER_SIZE + tx_frame_len]     = crc & 0xFF;
+      tx_frame[DGUS_HEADER_SIZE + tx_frame_len + 1] = crc >> 8;
+    #endif
+
+    const uint8_t frame_len = DGUS_HEADER_SIZE + tx_frame_len + DGUS_CRC_SIZE;
+    tx_frame_len = 0;
+
+    #if DGUS_TX_QUEUE_SIZE
+      if (tx_background) {
+        QueueFrame(tx_frame, frame_len);
+        return;
       }
-    } while (++ret);
-    DEBUG_ECHOLNPAIR_F("VP not found: ", (uint16_t)addr);
-    return false;
+
+      // A queued frame must not overwrite newer data for the same VPs
+      if (QueueOverlaps(tx_frame_addr, frame_len - DGUS_HEADER_SIZE - DGUS_CRC_SIZE))
+        SendQueue(false);
+    #endif
+
+    SendFrame(tx_frame, frame_len);
+  }
+
+  void DGUSDisplay::SendFrame(const uint8_t *frame, uint8_t len) {
+    #if DGUS_ACK_WINDOW
+      AckExpected(frame[4] << 8 | frame[5], len - DGUS_HEADER_SIZE - DGUS_CRC_SIZE);
+    #endif
+
+    stats.tx_frames++;
+    stats.tx_bytes += len;
+
+    LCD_SERIAL.write(frame, len);
+  }
+
+  #if DGUS_TX_QUEUE_SIZE
+
+    void DGUSDisplay::SetBackground(bool background) {
+      if (background == tx_background) return;
+
+      FlushFrame();           // Staged data keeps the priority it was written with
+      tx_background = background;
+
+      if (!background) SendQueue(true);
+    }
+
+    void DGUSDisplay::QueueFrame(const uint8_t *frame, uint8_t len) {
+      if (tx_queue_len + len > DGUS_TX_QUEUE_SIZE) {
+        // Move the unsent frames to the front
+        tx_queue_len -= tx_queue_sent;
+        memmove(tx_queue, &tx_queue[tx_queue_sent], tx_queue_len);
+        tx_queue_sent = 0;
+
+        if (tx_queue_len + len > DGUS_TX_QUEUE_SIZE) {
+          SendQueue(false);
+          SendFrame(frame, len);
+          return;
+        }
+      }
+
+      memcpy(&tx_queue[tx_queue_len], frame, len);
+      tx_queue_len += len;
+    }
+
+    void DGUSDisplay::SendQueue(bool paced) {
+      while (tx_queue_sent < tx_queue_len) {
+        const uint8_t *frame = &tx_queue[tx_queue_sent];
+        const uint8_t len    = frame[2] + 3;
+
+        if (paced && len > GetFreeSerialTx()) return;
+
+        SendFrame(frame, len);
+        tx_queue_sent += len;
+      }
+
+      tx_queue_len = tx_queue_sent = 0;
+    }
+
+    bool DGUSDisplay::QueueOverlaps(uint16_t addr, uint8_t size) {
+      for (uint16_t pos = tx_queue_sent; pos < tx_queue_len; pos += tx_queue[pos + 2] + 3) {
+        const uint8_t *frame      = &tx_queue[pos];
+        const uint16_t frame_addr = frame[4] << 8 | frame[5];
+        const uint8_t frame_size  = frame[2] - 3 - DGUS_CRC_SIZE;
+
+        // Compare in words
+        if (addr < frame_addr + (frame_size + 1) / 2 && frame_addr < addr + (size + 1) / 2)
+          return true;
+      }
+      return false;
+    }
+
+  #endif // DGUS_TX_QUEUE_SIZE
+
+  void DGUSDisplay::SetControlState(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control, bool enabled) {
+    control_t *entry = nullptr, *spare = nullptr;
+
+    LOOP_L_N(i, DGUS_CONTROL_QUEUE_SIZE) {
+      control_t &c = controls[i];
+      if (!c.state) {
+        if (!spare) spare = &c;
+      }
+      else if (c.screen == (uint8_t)screen && c.type == type && c.control == (uint8_t)control) {
+        entry = &c;
+        break;
+      }
+      else if (!spare && ControlSynced(c)) {
+        spare = &c; // Can be recycled, the display already shows the state
+      }
+    }
+
+    if (!entry) {
+      if (!spare) {
+        // Every slot is waiting to be sent; fall back to sending right away
+        SendControl(screen, type, control, enabled);
+        FlushTx();
+        delay(DGUS_CONTROL_INTERVAL_MS);
+        return;
+      }
+      entry          = spare;
+      entry->screen  = (uint8_t)screen;
+      entry->type    = type;
+      entry->control = (uint8_t)control;
+      entry->state   = _BV(CONTROL_USED);
+    }
+
+    SET_BIT_TO(entry->state, CONTROL_WANTED, enabled);
   }
 
+  void DGUSDisplay::ProcessControls() {
+    const millis_t ms = ExtUI::safe_millis();
+    if (PENDING(ms, control_next_ms)) return;
+
+    LOOP_L_N(i, DGUS_CONTROL_QUEUE_SIZE) {
+      control_t &c = controls[i];
+      if (!c.state || ControlSynced(c)) continue;
+
+      const bool enabled = TEST(c.state, CONTROL_WANTED);
+      SendControl((DGUS_Screen)c.screen, (DGUS_ControlType)c.type, (DGUS_Control)c.control, enabled);
+      SET_BIT_TO(c.state, CONTROL_SENT, enabled);
+      SBI(c.state, CONTROL_KNOWN);
+
+      // The display needs some time to process the command
+      control_next_ms = ms + DGUS_CONTROL_INTERVAL_MS;
+      return;
+    }
+  }
+
+  void DGUSDisplay::SendControl(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control, bool enabled) {
+    const uint8_t command[] = { 0x5A, 0xA5, 0x00, (uint8_t)screen, (uint8_t)control, type, 0x00, (uint8_t)enabled };
+    Write(0xB0, command, sizeof(command));
+  }
+
+  #if DGUS_SHADOW_SIZE
+
+    bool DGUSDisplay::ShadowMatch(uint16_t addr, const void *data_ptr, uint8_t size) {
+      // System variables are commands, always send them
+      if (addr < DGUS_SHADOW_MIN_ADDR || !size) return false;
+
+      const uint8_t *data = static_cast<const uint8_t *>(data_ptr);
+      uint32_t value      = 0;
+
+      if (size <= sizeof(value)) {
+        LOOP_L_N(i, size) value = (value << 8) | data[i];
+      }
+      else {
+        // Larger values are compared by their FNV-1a hash
+        value = 2166136261UL;
+        LOOP_L_N(i, size) value = (value ^ data[i]) * 16777619UL;
+      }
+
+      shadow_t *entry = nullptr;
+      LOOP_L_N(i, DGUS_SHADOW_SIZE) {
+        if (shadow[i].size && shadow[i].addr == addr) { entry = &shadow[i]; break; }
+      }
+
+      if (entry && entry->size == size) {
+        if (entry->value == value) return true;
+
+        if (deadband && (size == 2 || size == 4)) {
+          // Compare as signed big-endian integers; the reference stays at the last sent value
+          const int32_t sent = size == 2 ? (int32_t)(int16_t)entry->value : (int32_t)entry->value,
+                        now  = size == 2 ? (int32_t)(int16_t)value        : (int32_t)value;
+          if (ABS(now - sent) <= deadband) return true;
+        }
+      }
+
+      if (!entry) {
+        entry = &shadow[shadow_next];
+        if (++shadow_next >= DGUS_SHADOW_SIZE) shadow_next = 0;
+      }
+
+      entry->addr  = addr;
+      entry->size  = size;
+      entry->value = value;
+      return false;
+    }
+
+  #endif // DGUS_SHADOW_SIZE
+
 #endif // DGUS_LCD_UI_RELOADED
@@ -25,6 +25,7 @@
 
 #include "config/DGUS_Screen.h"
 #include "config/DGUS_Control.h"
+#include "config/DGUS_Constants.h"
 #include "definition/DGUS_VP.h"
 
 #include "../../../inc/MarlinConfigPre.h"
@@ -51,6 +52,12 @@ class DGUSDisplay {
       FIRMWARE_SETTINGS   = 0x07
     };
 
+    enum dgus_system_addr : uint16_t {
+      DGUS_VERSION         = 0x000f, // OS/GUI version
+      DGUS_CURRENT_PAGE    = 0x0014, // Page shown by the display
+      DGUS_SHADOW_MIN_ADDR = 0x1000  // Start of the user VP space
+    };
+
     DGUSDisplay() = default;
 
     static void Init();
@@ -58,16 +65,47 @@ class DGUSDisplay {
     static void Read(uint16_t addr, uint8_t size);
     static void Write(uint16_t addr, const void *data_ptr, uint8_t size);
 
+    // Strings are padded to size and skipped when the display already shows the same padded text.
     static void WriteString(uint16_t addr, const void *data_ptr, uint8_t size, bool left   =true, bool right=false, bool use_space=true);
     static void WriteStringPGM(uint16_t addr, const void *data_ptr, uint8_t size, bool left=true, bool right=false, bool use_space=true);
+    static void WriteString(uint16_t addr, FSTR_P const fstr, uint8_t size, bool left      =true, bool right=false, bool use_space=true);
 
     template<typename T>
     static void Write(uint16_t addr, T data) {
       Write(addr, static_cast<const void *>(&data), sizeof(T));
     }
 
-    // Until now I did not need to actively read from the display. That's why there is no ReadVariable
-    // (I extensively use the auto upload of the display)
+    // Write-combining: between StartBatch() and EndBatch(), writes to adjacent VP addresses
+    // are merged into one datagram of up to DGUS_TX_FRAME_SIZE bytes. Batches may be nested.
+    static void StartBatch();
+    static void EndBatch();
+
+    // Writes made while in background mode (screen refreshes) are queued and sent from Loop()
+    // when the serial port has room; all other writes go out first.
+    #if DGUS_TX_QUEUE_SIZE
+      static void SetBackground(bool background);
+    #else
+      static inline void SetBackground(bool) {}
+    #endif
+
+    // Writes of VP data that the display already holds are dropped.
+    // Forget everything we sent, e.g. when the display may have lost its state, or the VPs from addr on.
+    static void InvalidateShadow();
+    static void InvalidateShadow(uint16_t addr, uint8_t words=1);
+    // Deadband applied to the integer writes that follow. Reset to 0 when done.
+    static void SetDeadband(uint8_t deadband);
+    // Send the wanted state of every tracked control again.
+    static void InvalidateControls();
+    // The display was reset: forget what it showed and restore brightness and volume.
+    static void Resync();
+
+    // Most values come in through the auto upload of the display. To read one actively, ReadAsync()
+    // requests words from addr and calls back from Loop() with the answer, or with data == nullptr
+    // after DGUS_READ_TIMEOUT_MS. Reads pending when the link is reset are dropped without a call.
+    // Returns false if all DGUS_READ_SLOTS are busy.
+    // data points into the RX buffer and is only valid during the callback.
+    typedef void (*read_callback_t)(uint16_t addr, const uint8_t *data, uint8_t len);
+    static bool ReadAsync(uint16_t addr, uint8_t words, read_callback_t callback);
 
     // Force display into another screen.
     static void SwitchScreen(DGUS_Screen screen);
@@ -79,6 +117,7 @@ class DGUSDisplay {
     // Enable/disable a specific touch control.
     //   type: control type.
     //   control: index of the control on the page (set during screen development).
+    // Only changes are sent, paced by DGUS_CONTROL_INTERVAL_MS from Loop().
     static void EnableControl(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control);
     static void DisableControl(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control);
 
@@ -93,8 +132,26 @@ class DGUSDisplay {
     static void Loop();
 
     // Helper for users of this class to estimate if an interaction would be blocking.
+    // Returns 0 while DGUS_ACK_WINDOW writes wait for the display's ACK.
     static size_t GetFreeTxBuffer();
     static void FlushTx();
+    // Instead of Loop() once the printer is killed: only takes the ACKs of our writes and gives up
+    // on the missing ones. Anything else received is dropped, no handler runs anymore.
+    static void ProcessAcksOnly();
+
+    #if DGUS_ACK_WINDOW
+      // Average time from sending a write to its ACK, in ms, and the ACKs given up on.
+      static uint16_t GetAckRtt();
+      static uint16_t GetAckTimeouts();
+    #endif
+
+    #if ENABLED(DGUS_CRC)
+      // Datagrams dropped for a bad CRC. DGUS_CRC needs the CRC mode enabled in the display's config.
+      static uint16_t GetCRCErrors();
+    #endif
+
+    // Modbus CRC16 as used by the display, continuing from crc. Also checks the stored UI settings.
+    static uint16_t CRC16(const uint8_t *data, uint8_t len, uint16_t crc=0xFFFF);
 
     // Checks two things: Can we confirm the presence of the display and has we initiliazed it.
     // (both boils down that the display answered to our chatting)
@@ -102,6 +159,31 @@ class DGUSDisplay {
       return initialized;
     }
 
+    // Link speed found on startup (see DGUS_BAUDRATES) and the time the display took to answer, in ms.
+    static uint32_t GetBaudrate();
+    static uint16_t GetLinkRtt();
+    static inline bool IsProbing() {
+      return baud_index != BAUD_SETTLED;
+    }
+
+    static constexpr uint8_t DGUS_LATENCY_BUCKETS = 8;
+
+    // Link statistics, shown on the DEBUG screen. DEBUG_DumpStats prints them to the serial port.
+    struct link_stats_t {
+      uint32_t tx_bytes;
+      uint32_t tx_frames;
+      uint16_t tx_bytes_ps;     // During the last second
+      uint16_t tx_frames_ps;
+      uint16_t rx_datagrams;
+      uint16_t unknown_vp;
+      uint16_t size_mismatch;
+      uint16_t overruns;
+      uint16_t latency[DGUS_LATENCY_BUCKETS]; // Touch to handler: <=2, 5, 10, 20, 50, 100, 200, more ms
+    };
+
+    static link_stats_t stats;
+    static void DumpStats();
+
     static uint8_t gui_version;
     static uint8_t os_version;
 
@@ -146,20 +228,190 @@ class DGUSDisplay {
       DGUS_WAIT_TELEGRAM, // < LEN received, Waiting for to receive all bytes.
     };
 
-    enum dgus_system_addr : uint16_t {
-      DGUS_VERSION = 0x000f // OS/GUI version
+    static constexpr uint8_t DGUS_HEADER_SIZE = 6; // Header, length, command and address
+    static constexpr uint8_t DGUS_CRC_SIZE    = ENABLED(DGUS_CRC) ? 2 : 0;
+
+    // A string in RAM or PROGMEM
+    struct string_source_t {
+      const char *data;
+      bool pgm;
+
+      inline void CopyTo(uint8_t *dest, uint8_t len, uint8_t offset=0) const {
+        if (pgm)
+          memcpy_P(dest, data + offset, len);
+        else
+          memcpy(dest, data + offset, len);
+      }
     };
 
+    static void WriteString(uint16_t addr, const string_source_t &str, uint8_t size, bool left, bool right, bool use_space);
+
+    // Unstaged frames: WriteHeader(), then the payload through TxPayload()/TxByte(), then WriteFooter().
     static void WriteHeader(uint16_t addr, uint8_t command, uint8_t len);
+    static void TxPayload(const void *data_ptr, uint8_t len);
+    static void TxByte(uint8_t value);
+    static void WriteFooter();
+    static void BuildHeader(uint8_t *header, uint16_t addr, uint8_t command, uint8_t len);
+
+    // Reserve size bytes for addr in the pending frame. Returns nullptr if the write does not fit.
+    static uint8_t* StageWrite(uint16_t addr, uint8_t size);
+    static void FlushFrame();
+    static void SendFrame(const uint8_t *frame, uint8_t len);
+    static size_t GetFreeSerialTx();
+
+    #if DGUS_TX_QUEUE_SIZE
+      static void QueueFrame(const uint8_t *frame, uint8_t len);
+      // Send queued frames, paced: only as long as the serial port has room
+      static void SendQueue(bool paced);
+      // A queued frame writes to one of the words in addr..addr+size
+      static bool QueueOverlaps(uint16_t addr, uint8_t size);
+    #endif
+
+    struct control_t {
+      uint8_t screen;
+      uint8_t type;
+      uint8_t control;
+      uint8_t state;    // 0 = unused
+    };
+
+    enum control_state_bit : uint8_t {
+      CONTROL_USED,
+      CONTROL_WANTED,   // State requested by the UI
+      CONTROL_SENT,     // State last sent to the display
+      CONTROL_KNOWN     // CONTROL_SENT is valid
+    };
+
+    static inline bool ControlSynced(const control_t &c) {
+      return TEST(c.state, CONTROL_KNOWN) && TEST(c.state, CONTROL_WANTED) == TEST(c.state, CONTROL_SENT);
+    }
+
+    static void SetControlState(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control, bool enabled);
+    static void SendControl(DGUS_Screen screen, DGUS_ControlType type, DGUS_Control control, bool enabled);
+    static void ProcessControls();
+
+    #if DGUS_SHADOW_SIZE
+      // Returns true if the display already holds this value, otherwise records it as sent.
+      static bool ShadowMatch(uint16_t addr, const void *data_ptr, uint8_t size);
+
+      struct shadow_t {
+        uint16_t addr;
+        uint8_t size;     // 0 = unused
+        uint32_t value;   // Raw bytes for values up to 4 bytes, a hash otherwise
+      };
+    #endif
     static void ProcessRx();
+    static void ReceiveDatagrams();
+    static void ProcessStats();
+    static void RecordLatency(const millis_t latency);
+
+    struct read_request_t {
+      uint16_t addr;
+      uint8_t words;
+      read_callback_t callback; // nullptr = unused
+      millis_t timeout;
+    };
+
+    // Hand a read answer to its request. Returns false if nobody asked for it.
+    static bool ReadReceived(uint16_t addr, const uint8_t *data, uint8_t len);
+    static void ProcessReadTimeouts();
+    // Drop all pending reads without calling back, a reset link is not a timeout
+    static void CancelReads();
+
+    static void VersionReceived(uint16_t addr, const uint8_t *data, uint8_t len);
+
+    static constexpr uint8_t BAUD_SETTLED = 0xFF;
+
+    static void StartLinkProbe();
+    static void ProcessLinkProbe();
+    // Forget the display state after (re)establishing the link. Buffered frames are kept.
+    static void ResetLink();
+    // Drop everything received, e.g. at a previous baudrate
+    static void FlushRx();
+
+    #if DGUS_ACK_WINDOW
+      static void AckExpected(uint16_t addr, uint8_t len);
+      static void AckReceived();
+      // The oldest write is no longer waited for. Unless acknowledged, it may be lost: send it again next time.
+      static void AckDone(bool acknowledged);
+      static void ProcessAckTimeouts();
+    #endif
+    // Handle one telegram, data points into the RX ring. Returns false for write ACKs.
+    static bool ProcessDatagram(uint8_t command, uint8_t *data, uint8_t len);
+
+    static inline uint16_t RxUsed() {
+      return (rx_head - rx_tail) & (DGUS_RX_RING_SIZE - 1);
+    }
+
+    static inline uint8_t RxByte() {
+      const uint8_t value = rx_ring[rx_tail];
+      rx_tail             = (rx_tail + 1) & (DGUS_RX_RING_SIZE - 1);
+      return value;
+    }
 
     static uint8_t volume;
     static uint8_t brightness;
 
     static rx_datagram_state_t rx_datagram_state;
     static uint8_t rx_datagram_len;
+    static uint8_t rx_ring[DGUS_RX_RING_SIZE + DGUS_RX_TELEGRAM_SIZE]; // Ring + room to mirror a wrapped telegram
+    static uint16_t rx_head;
+    static uint16_t rx_tail;
+    static bool rx_busy;              // Handling a datagram
+    static bool rx_acks_only;         // Drop everything but ACKs, see ProcessAcksOnly()
 
     static bool initialized;
+
+    static millis_t stats_next_ms;
+    static uint32_t stats_tx_bytes;   // Totals at the start of the second
+    static uint32_t stats_tx_frames;
+    static millis_t rx_idle_ms;       // Last time everything received was handled
+
+    static uint8_t baud_index;      // Baudrate being probed, BAUD_SETTLED when done
+    static uint32_t baudrate;
+    static millis_t baud_probe_ms;  // Give up probing after this
+    static millis_t link_probe_ms;  // Version request sent
+    static uint16_t link_rtt;
+
+    static uint8_t tx_frame[DGUS_HEADER_SIZE + DGUS_TX_FRAME_SIZE + DGUS_CRC_SIZE]; // Header and CRC are filled in when flushing
+    static uint16_t tx_frame_addr;
+    static uint8_t tx_frame_len;
+    static uint8_t tx_batch;
+
+    #if DGUS_TX_QUEUE_SIZE
+      static uint8_t tx_queue[DGUS_TX_QUEUE_SIZE]; // Complete background frames
+      static uint16_t tx_queue_len;
+      static uint16_t tx_queue_sent;
+      static bool tx_background;
+    #endif
+
+    static read_request_t reads[DGUS_READ_SLOTS];
+
+    static control_t controls[DGUS_CONTROL_QUEUE_SIZE];
+    static millis_t control_next_ms;
+
+    #if ENABLED(DGUS_CRC)
+      static uint16_t tx_crc;
+      static uint16_t crc_errors;
+    #endif
+
+    #if DGUS_ACK_WINDOW
+      static uint16_t ack_sent_ms[DGUS_ACK_WINDOW]; // Send time of the unacknowledged writes
+      static uint16_t ack_addr[DGUS_ACK_WINDOW];    // and what they wrote
+      static uint8_t ack_len[DGUS_ACK_WINDOW];
+      static uint8_t ack_pending;
+      static uint8_t ack_oldest;
+      static bool ack_seen;
+      static bool ack_disabled;
+      static uint16_t ack_rtt_avg;
+      static uint16_t ack_rtt_max;
+      static uint16_t ack_timeouts;
+    #endif
+
+    #if DGUS_SHADOW_SIZE
+      static shadow_t shadow[DGUS_SHADOW_SIZE];
+      static uint8_t shadow_next;
+      static uint8_t deadband;
+    #endif
 };
 
 template<> inline uint16_t DGUSDisplay::SwapBytes(const uint16_t value) {
@@ -0,0 +1,382 @@
+/**
+  * Marlin 3D Printer Firmware
+  * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+  *
+  * Based on Sprinter and grbl.
+  * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  *
+  */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if BOTH(DGUS_LCD_UI_RELOADED, SDSUPPORT)
+
+  #include "DGUSFileIndex.h"
+
+  #include "../../../sd/cardreader.h"
+  #include "../../../MarlinCore.h"
+
+  namespace DGUSFileIndex {
+
+    // Layout of the index file:
+    //   header_t
+    //   uint16_t order[count]    Record numbers in sorted order
+    //   record_t records[count]  In directory order
+    constexpr uint32_t INDEX_MAGIC   = 0x58494744; // "DGIX"
+    constexpr uint8_t INDEX_VERSION  = 2;
+    constexpr uint32_t HASH_BASIS    = 2166136261UL;
+
+    struct header_t {
+      uint32_t magic;
+      uint32_t stamp;       // Hash over the listed directory entries, 0 until the index is complete
+      uint16_t count;
+      uint8_t version;
+      uint8_t sort;
+    };
+
+    struct record_t {
+      uint32_t modified;    // FAT write date << 16 | time
+      DGUSScreenHandler::file_entry_t entry;
+      char longname[LONG_FILENAME_LENGTH]; // Untruncated name, entry.name only holds what fits on the screen
+    };
+
+    enum state_t : uint8_t {
+      IDLE,
+      CHECK,                // Counting and hashing the directory
+      BUILD,                // Adding the entries to a new index
+      READY,
+      FAILED                // No index for this directory, e.g. on a write-protected card
+    };
+
+    static state_t state            = IDLE;
+    static DGUS_Data::FileSort sort = (DGUS_Data::FileSort)DGUS_FILE_SORT;
+
+    static SdFile dir;      // Own handle of the working directory, used from CHECK to READY and by Next()
+    static SdFile index;
+    static uint16_t count;  // Entries counted (CHECK) or added (BUILD) so far
+    static uint16_t total;  // Entries in the index
+    static uint32_t stamp;
+
+    static SdFile walk_dir; // Cursor of Next() while there is no index
+    static uint16_t walk_pos;
+    static bool walk_sorted;
+
+    static uint32_t OrderPos(const uint16_t pos) {
+      return sizeof(header_t) + (uint32_t)pos * sizeof(uint16_t);
+    }
+
+    static uint32_t RecordPos(const uint16_t num) {
+      return OrderPos(total) + (uint32_t)num * sizeof(record_t);
+    }
+
+    static bool Read(const uint32_t pos, void *const buffer, const uint16_t len) {
+      return index.seekSet(pos) && index.read(buffer, len) == (int16_t)len;
+    }
+
+    static bool Write(const uint32_t pos, const void *const buffer, const uint16_t len) {
+      return index.seekSet(pos) && index.write(buffer, len) == (int16_t)len;
+    }
+
+    static uint32_t Hash(uint32_t hash, const void *const data, size_t len) {
+      // FNV-1a
+      const uint8_t *bytes = (const uint8_t *)data;
+      while (len--) {
+        hash ^= *bytes++;
+        hash *= 16777619UL;
+      }
+      return hash;
+    }
+
+    // Same selection as CardReader::is_visible_entity(), which is private: directories and G-code files, nothing hidden
+    static bool NextEntry(SdFile &from, dir_t &entry, char *const longname) {
+      while (from.readDir(&entry, longname) > 0) {
+        if (entry.name[0] == DIR_NAME_DELETED || entry.name[0] == '.' || longname[0] == '.') continue;
+        if (!DIR_IS_FILE_OR_SUBDIR(&entry) || (entry.attributes & DIR_ATT_HIDDEN)) continue;
+        if (DIR_IS_SUBDIR(&entry) || (entry.name[8] == 'G' && entry.name[9] != '~')) return true;
+      }
+      return false;
+    }
+
+    static void ShortName(char *name, const dir_t &entry) {
+      LOOP_L_N(i, 11) {
+        if (entry.name[i] == ' ') continue;
+        if (i == 8) *name++ = '.';
+        *name++ = entry.name[i];
+      }
+      *name = '\0';
+    }
+
+    // Directories first, then by name or newest first
+    static bool Before(const record_t &a, const record_t &b) {
+      const bool a_dir = a.entry.type == DGUS_Data::SDType::DIRECTORY,
+                 b_dir = b.entry.type == DGUS_Data::SDType::DIRECTORY;
+
+      if (a_dir != b_dir) return a_dir;
+      if (sort == DGUS_Data::FileSort::DATE && a.modified != b.modified) return a.modified > b.modified;
+      return strcasecmp(a.longname, b.longname) < 0;
+    }
+
+    static void MakeRecord(record_t &record, const dir_t &entry, const char *const longname) {
+      record.modified   = (uint32_t)entry.lastWriteDate << 16 | entry.lastWriteTime;
+      record.entry.type = DIR_IS_SUBDIR(&entry) ? DGUS_Data::SDType::DIRECTORY : DGUS_Data::SDType::FILE;
+      ShortName(record.entry.short_name, entry);
+      strncpy(record.longname, longname[0] ? longname : record.entry.short_name, sizeof(record.longname) - 1);
+      record.longname[sizeof(record.longname) - 1] = '\0';
+      strncpy(record.entry.name, record.longname, sizeof(record.entry.name) - 1);
+      record.entry.name[sizeof(record.entry.name) - 1] = '\0';
+    }
+
+    static bool ReadSorted(const uint16_t pos, record_t &record) {
+      uint16_t num;
+      return Read(OrderPos(pos), &num, sizeof(num)) && Read(RecordPos(num), &record, sizeof(record));
+    }
+
+    // Append the record and insert its number into the sorted order.
+    // A binary search plus moving the order up on the card, so building is O(n²): see DGUS_FILE_INDEX_MAX.
+    static bool AddEntry(const dir_t &entry, const char *const longname) {
+      record_t record;
+      MakeRecord(record, entry, longname);
+
+      if (!Write(RecordPos(count), &record, sizeof(record))) return false;
+
+      uint16_t lo = 0, hi = count;
+      while (lo < hi) {
+        const uint16_t mid = lo + (hi - lo) / 2;
+        record_t other;
+        if (!ReadSorted(mid, other)) return false;
+        if (Before(record, other))
+          hi = mid;
+        else
+          lo = mid + 1;
+      }
+
+      // Move order[lo..count) up by one, last part first
+      uint16_t end = count;
+      while (end > lo) {
+        uint16_t buffer[16];
+        const uint16_t len = _MIN(end - lo, (uint16_t)COUNT(buffer));
+        end -= len;
+        if (!Read(OrderPos(end), buffer, len * sizeof(*buffer))
+            || !Write(OrderPos(end + 1), buffer, len * sizeof(*buffer))
+            ) return false;
+      }
+
+      if (!Write(OrderPos(lo), &count, sizeof(count))) return false;
+
+      count++;
+      return true;
+    }
+
+    static void Restart(const state_t new_state) {
+      dir.rewind();
+      count = 0;
+      state = new_state;
+    }
+
+    static void Fail() {
+      DEBUG_ECHOLNPGM("File index failed");
+
+      index.close();
+      state = FAILED;
+    }
+
+    static void StartBuild() {
+      index.close();
+      if (!index.open(&dir, DGUS_FILE_INDEX_NAME, O_RDWR | O_CREAT | O_TRUNC))
+        return Fail();
+
+      const header_t header = { INDEX_MAGIC, 0, total, INDEX_VERSION, (uint8_t)sort };
+      if (!Write(0, &header, sizeof(header))) return Fail();
+
+      // Reserve the order, the records are appended behind it
+      const uint16_t zero[16] = { 0 };
+      for (uint16_t pos = 0; pos < total; pos += COUNT(zero))
+        if (!Write(OrderPos(pos), zero, _MIN(total - pos, (uint16_t)COUNT(zero)) * sizeof(*zero)))
+          return Fail();
+
+      Restart(BUILD);
+    }
+
+    // End of the directory reached
+    static bool Finish() {
+      if (state == CHECK) {
+        total = count;
+        if (!stamp) stamp = 1;
+
+        header_t header;
+        if (total > DGUS_FILE_INDEX_MAX) {
+          DEBUG_ECHOLNPAIR_F("No file index, entries: ", total);
+          state = FAILED;
+          return false;
+        }
+
+        if (index.open(&dir, DGUS_FILE_INDEX_NAME, O_READ)
+            && Read(0, &header, sizeof(header))
+            && header.magic == INDEX_MAGIC
+            && header.version == INDEX_VERSION
+            && header.sort == (uint8_t)sort
+            && header.count == total
+            && header.stamp == stamp
+            ) {
+          state = READY;
+          return true;
+        }
+
+        DEBUG_ECHOLNPAIR_F("Building file index, entries: ", total);
+
+        StartBuild();
+        return false;
+      }
+
+      if (count != total) {
+        Fail();
+        return false;
+      }
+
+      const header_t header = { INDEX_MAGIC, stamp, total, INDEX_VERSION, (uint8_t)sort };
+      if (!Write(0, &header, sizeof(header)) || !index.sync()) {
+        Fail();
+        return false;
+      }
+
+      state = READY;
+      return true;
+    }
+
+    void ChangeDir() {
+      Reset();
+
+      if (!card.isMounted()) return;
+
+      dir = card.getWorkDir();
+
+      // Check once, the directory is walked again only to build
+      #if ENABLED(DGUS_FILE_INDEX)
+        stamp = HASH_BASIS;
+        Restart(CHECK);
+      #endif
+    }
+
+    void Reset() {
+      if (state != IDLE) {
+        index.close();
+        state = IDLE;
+      }
+    }
+
+    void SetSort(const DGUS_Data::FileSort mode) {
+      if (mode == sort) return;
+
+      sort = mode;
+      if (state != IDLE) ChangeDir();
+    }
+
+    bool Loop() {
+      if (state != CHECK && state != BUILD) return false;
+
+      // The card belongs to the print job
+      if (printingIsActive() || printingIsPaused()) return false;
+
+      const millis_t start = ExtUI::safe_millis();
+      dir_t entry;
+      char longname[LONG_FILENAME_LENGTH];
+
+      do {
+        if (!NextEntry(dir, entry, longname)) return Finish();
+
+        if (state == CHECK) {
+          count++;
+          stamp = Hash(stamp, entry.name, sizeof(entry.name));
+          stamp = Hash(stamp, &entry.lastWriteTime, sizeof(entry.lastWriteTime));
+          stamp = Hash(stamp, &entry.lastWriteDate, sizeof(entry.lastWriteDate));
+          stamp = Hash(stamp, longname, strlen(longname));
+        }
+        else if (count >= total) {
+          Fail(); // Changed since it was checked, ChangeDir() checks again
+          return false;
+        }
+        else if (!AddEntry(entry, longname)) {
+          Fail();
+          return false;
+        }
+      } while (PENDING(ExtUI::safe_millis(), start + DGUS_FILE_INDEX_MS));
+
+      return false;
+    }
+
+    bool IsReady() {
+      return state == READY;
+    }
+
+    uint16_t Count() {
+      return total;
+    }
+
+    bool ReadPage(const uint16_t pos, DGUSScreenHandler::file_entry_t *const page) {
+      if (state != READY) return false;
+
+      uint16_t order[DGUS_FILE_COUNT];
+      const uint16_t len = pos < total ? _MIN(total - pos, (uint16_t)DGUS_FILE_COUNT) : 0;
+      if (len && !Read(OrderPos(pos), order, len * sizeof(*order))) {
+        Fail();
+        return false;
+      }
+
+      LOOP_L_N(i, DGUS_FILE_COUNT) {
+        if (i < len && Read(RecordPos(order[i]) + offsetof(record_t, entry), &page[i], sizeof(page[i])))
+          continue;
+
+        page[i].type          = DGUS_Data::SDType::NONE;
+        page[i].name[0]       = '\0';
+        page[i].short_name[0] = '\0';
+      }
+
+      return true;
+    }
+
+    void Rewind() {
+      walk_pos    = 0;
+      walk_sorted = IsReady();
+
+      if (!walk_sorted) {
+        walk_dir = dir;
+        walk_dir.rewind();
+      }
+    }
+
+    bool Next(DGUSScreenHandler::file_entry_t &entry, char *const longname) {
+      record_t record;
+      longname[0] = '\0'; // Also at the end
+
+      if (walk_sorted) {
+        if (walk_pos >= total || !ReadSorted(walk_pos, record)) return false;
+        walk_pos++;
+      }
+      else {
+        dir_t dir_entry;
+        char dir_longname[LONG_FILENAME_LENGTH];
+        if (!card.isMounted() || !NextEntry(walk_dir, dir_entry, dir_longname)) return false;
+        MakeRecord(record, dir_entry, dir_longname);
+      }
+
+      entry = record.entry;
+      strcpy(longname, record.longname);
+      return true;
+    }
+
+  }
+
+#endif // DGUS_LCD_UI_RELOADED && SDSUPPORT
@@ -0,0 +1,55 @@
+/**
+  * Marlin 3D Printer Firmware
+  * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+  *
+  * Based on Sprinter and grbl.
+  * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  *
+  */
+
+#pragma once
+
+#include "DGUSScreenHandler.h"
+
+// Sorted index of the current SD directory, kept in a file on the card (DGUS_FILE_INDEX_NAME).
+// With DGUS_FILE_INDEX, ChangeDir() has it checked once against the directory while the PRINT
+// screen is shown and, if outdated, rebuilt in the background. Once ready, any page of entries is
+// read without walking the directory. Directories of more than DGUS_FILE_INDEX_MAX entries, or that
+// change while building, get no index. Without DGUS_FILE_INDEX nothing is written to the card.
+namespace DGUSFileIndex {
+
+  // The working directory changed: check its index from the start. Until the next call the
+  // index stays with this directory, even if the working directory changes meanwhile.
+  void ChangeDir();
+  // Stop using the card, e.g. once it was removed.
+  void Reset();
+
+  void SetSort(const DGUS_Data::FileSort mode);
+
+  // Check or build for up to DGUS_FILE_INDEX_MS. Returns true once the index became ready.
+  bool Loop();
+
+  bool IsReady();
+  uint16_t Count();
+  // Read the DGUS_FILE_COUNT entries from pos on, in sorted order. Returns false without a ready index.
+  bool ReadPage(const uint16_t pos, DGUSScreenHandler::file_entry_t *const page);
+
+  // Go through all entries one by one, sorted if the index is ready. Rewind() starts over.
+  void Rewind();
+  // Also gives the full long name, longname holds LONG_FILENAME_LENGTH chars. Returns false at the end.
+  bool Next(DGUSScreenHandler::file_entry_t &entry, char *const longname);
+
+}
@@ -28,6 +28,9 @@
 
   #include "DGUSScreenHandler.h"
   #include "config/DGUS_Screen.h"
+  #if ENABLED(SDSUPPORT)
+    #include "DGUSFileIndex.h"
+  #endif
 
   #include "../ui_api.h"
   #include "../../../core/language.h"
@@ -142,6 +145,7 @@
           dgus_screen_handler.filelist_offset   = 0;
           dgus_screen_handler.filelist_selected = -1;
           dgus_screen_handler.filelist.upDir();
+          DGUSFileIndex::ChangeDir();
           break;
 
         case DGUS_Data::Scroll::UP:
@@ -151,14 +155,15 @@
           break;
 
         case DGUS_Data::Scroll::DOWN:
-          if (dgus_screen_handler.filelist_offset + offset >= dgus_screen_handler.filelist.count())
-            offset = dgus_screen_handler.filelist.count() - offset;
+          if (dgus_screen_handler.filelist_offset + offset >= dgus_screen_handler.FileCount())
+            offset = dgus_screen_handler.FileCount() - offset;
 
           dgus_screen_handler.filelist_offset += offset;
           break;
       }
-      DEBUG_ECHOLNPAIR_F("New offset ", dgus_screen_handler.filelist_offset, " file count ", dgus_screen_handler.filelist.count());
+      DEBUG_ECHOLNPAIR_F("New offset ", dgus_screen_handler.filelist_offset, " file count ", dgus_screen_handler.FileCount());
 
+      dgus_screen_handler.RefreshFilePage();
       dgus_screen_handler.TriggerFullUpdate();
     }
 
@@ -167,16 +172,24 @@
 
       const uint8_t index = ((uint8_t *)data_ptr)[1];
 
-      if (!dgus_screen_handler.filelist.seek(dgus_screen_handler.filelist_offset + index))
+      if (index >= DGUS_FILE_COUNT)
+        return;
+
+      const DGUSScreenHandler::file_entry_t &entry = dgus_screen_handler.file_page[index];
+
+      if (entry.type == DGUS_Data::SDType::NONE)
         return;
 
-      if (dgus_screen_handler.filelist.isDir()) {
+      if (entry.type == DGUS_Data::SDType::DIRECTORY) {
         dgus_screen_handler.filelist_offset   = 0;
         dgus_screen_handler.filelist_selected = -1;
-        dgus_screen_handler.filelist.changeDir(dgus_screen_handler.filelist.filename());
+        dgus_screen_handler.filelist.changeDir(entry.short_name);
+        DGUSFileIndex::ChangeDir();
+        dgus_screen_handler.RefreshFilePage();
       }
       else {
         dgus_screen_handler.filelist_selected = dgus_screen_handler.filelist_offset + index;
+        dgus_screen_handler.file_selected     = entry;
       }
 
       dgus_screen_handler.TriggerFullUpdate();
@@ -191,7 +204,7 @@
         return;
       }
 
-      if (!dgus_screen_handler.filelist.seek(dgus_screen_handler.filelist_selected) || dgus_screen_handler.filelist.isDir())
+      if (dgus_screen_handler.file_selected.type != DGUS_Data::SDType::FILE)
         return;
 
       if (!dgus_screen_handler.IsPrinterIdle()) {
@@ -199,10 +212,38 @@
         return;
       }
 
-      ExtUI::printFile(dgus_screen_handler.filelist.shortFilename());
+      ExtUI::printFile(dgus_screen_handler.file_selected.short_name);
       dgus_screen_handler.TriggerScreenChange(DGUS_Screen::PRINT_STATUS);
     }
 
+    void DGUSRxHandler::SortFiles(DGUS_VP &vp, void *data_ptr) {
+      UNUSED(vp);
+
+      const DGUS_Data::FileSort sort = (DGUS_Data::FileSort)((uint8_t *)data_ptr)[1];
+
+      switch (sort) {
+        default: return;
+        case DGUS_Data::FileSort::NAME:
+        case DGUS_Data::FileSort::DATE:
+          break;
+      }
+
+      DGUSFileIndex::SetSort(sort);
+
+      dgus_screen_handler.filelist_offset = 0;
+      dgus_screen_handler.RefreshFilePage();
+      dgus_screen_handler.TriggerFullUpdate();
+    }
+
+    void DGUSRxHandler::FileFilter(DGUS_VP &vp, void *data_ptr) {
+      StringToExtra(vp, data_ptr);
+
+      dgus_screen_handler.filelist_offset   = 0;
+      dgus_screen_handler.filelist_selected = -1;
+      dgus_screen_handler.RefreshFilePage();
+      dgus_screen_handler.TriggerFullUpdate();
+    }
+
   #endif // SDSUPPORT
 
   void DGUSRxHandler::PrintAbort(DGUS_VP &vp, void *data_ptr) {
@@ -279,7 +320,7 @@
 
     ExtUI::setFeedrate_percent(feedrate);
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::ADJUST_Feedrate);
   }
 
   void DGUSRxHandler::Flowrate(DGUS_VP &vp, void *data_ptr) {
@@ -305,7 +346,11 @@
         #endif
     }
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::ADJUST_Flowrate_CUR);
+    #if EXTRUDERS > 1
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::ADJUST_Flowrate_E0);
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::ADJUST_Flowrate_E1);
+    #endif
   }
 
   void DGUSRxHandler::BabystepSet(DGUS_VP &vp, void *data_ptr) {
@@ -318,11 +363,8 @@
 
     ExtUI::smartAdjustAxis_steps(steps, ExtUI::Z, true);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
-
     dgus_screen_handler.TriggerEEPROMSave();
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::LEVEL_OFFSET_Current);
   }
 
   void DGUSRxHandler::Babystep(DGUS_VP &vp, void *data_ptr) {
@@ -344,11 +386,8 @@
 
     ExtUI::smartAdjustAxis_steps(steps, ExtUI::Z, true);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
-
     dgus_screen_handler.TriggerEEPROMSave();
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::LEVEL_OFFSET_Current);
   }
 
   void DGUSRxHandler::TempPreset(DGUS_VP &vp, void *data_ptr) {
@@ -383,7 +422,11 @@
         break;
     }
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_Bed);
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_H0);
+    #if HOTENDS > 1
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_H1);
+    #endif
   }
 
   void DGUSRxHandler::TempTarget(DGUS_VP &vp, void *data_ptr) {
@@ -407,7 +450,11 @@
         #endif
     }
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_Bed);
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_H0);
+    #if HOTENDS > 1
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_H1);
+    #endif
   }
 
   void DGUSRxHandler::TempCool(DGUS_VP &vp, void *data_ptr) {
@@ -440,7 +487,11 @@
 
     dgus_screen_handler.SetStatusMessagePGM(DGUS_MSG_COOLING);
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_Bed);
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_H0);
+    #if HOTENDS > 1
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::TEMP_Target_H1);
+    #endif
   }
 
   void DGUSRxHandler::Steppers(DGUS_VP &vp, void *data_ptr) {
@@ -498,10 +549,8 @@
 
       ExtUI::smartAdjustAxis_steps(steps, ExtUI::Z, true);
 
-      settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
-      // dgus_screen_handler.TriggerEEPROMSave();
-      dgus_screen_handler.TriggerFullUpdate();
+      dgus_screen_handler.TriggerEEPROMSave();
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::LEVEL_OFFSET_Current);
     }
 
     void DGUSRxHandler::ZOffsetStep(DGUS_VP &vp, void *data_ptr) {
@@ -533,10 +582,8 @@
 
       ExtUI::smartAdjustAxis_steps(steps, ExtUI::Z, true);
 
-      settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
-      // dgus_screen_handler.TriggerEEPROMSave();
-      dgus_screen_handler.TriggerFullUpdate();
+      dgus_screen_handler.TriggerEEPROMSave();
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::LEVEL_OFFSET_Current);
     }
 
     void DGUSRxHandler::ZOffsetSetStep(DGUS_VP &vp, void *data_ptr) {
@@ -546,7 +593,7 @@
 
       dgus_screen_handler.offset_steps = size;
 
-      dgus_screen_handler.TriggerFullUpdate();
+      dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::LEVEL_OFFSET_StepIcons);
     }
 
   #endif // if HAS_LEVELING
@@ -632,7 +679,7 @@
         break;
     }
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::FILAMENT_ExtruderIcons);
   }
 
   void DGUSRxHandler::FilamentLength(DGUS_VP &vp, void *data_ptr) {
@@ -642,7 +689,7 @@
 
     dgus_screen_handler.filament_length = constrain(length, 0, EXTRUDE_MAXLENGTH);
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::FILAMENT_Length);
   }
 
   void DGUSRxHandler::FilamentMove(DGUS_VP &vp, void *data_ptr) {
@@ -867,7 +914,7 @@
 
     dgus_screen_handler.move_steps = size;
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::MOVE_StepIcons);
   }
 
   void DGUSRxHandler::GcodeClear(DGUS_VP &vp, void *data_ptr) {
@@ -876,7 +923,7 @@
 
     ZERO(dgus_screen_handler.gcode);
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::GCODE_Data);
   }
 
   void DGUSRxHandler::GcodeExecute(DGUS_VP &vp, void *data_ptr) {
@@ -978,7 +1025,9 @@
 
     dgus_screen_handler.pid_cycles = 5;
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::PID_HeaterIcons);
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::PID_Temp);
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::PID_Cycles);
   }
 
   void DGUSRxHandler::PIDSetTemp(DGUS_VP &vp, void *data_ptr) {
@@ -1009,7 +1058,7 @@
 
     dgus_screen_handler.pid_temp = temp;
 
-    dgus_screen_handler.TriggerFullUpdate();
+    dgus_screen_handler.TriggerVPUpdate(DGUS_Addr::PID_Temp);
   }
 
   void DGUSRxHandler::PIDRun(DGUS_VP &vp, void *data_ptr) {
@@ -1166,8 +1215,6 @@
     uint8_t volume = ((uint8_t *)data_ptr)[1];
     dgus_display.SetVolume(volume);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
     dgus_screen_handler.TriggerEEPROMSave();
   }
 
@@ -1177,8 +1224,6 @@
     uint8_t brightness = ((uint8_t *)data_ptr)[1];
     dgus_display.SetBrightness(brightness);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
     dgus_screen_handler.TriggerEEPROMSave();
   }
 
@@ -1188,8 +1233,7 @@
     const float value  = dgus_display.FromFixedPoint<int32_t, float, 2>(data);
     ExtUI::setAxisSteps_per_mm(value, ExtUI::axis_t::X);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::StepsPerMmY(DGUS_VP &vp, void *data_ptr) {
@@ -1197,8 +1241,7 @@
     const float value  = dgus_display.FromFixedPoint<int32_t, float, 2>(data);
     ExtUI::setAxisSteps_per_mm(value, ExtUI::axis_t::Y);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::StepsPerMmZ(DGUS_VP &vp, void *data_ptr) {
@@ -1206,8 +1249,7 @@
     const float value  = dgus_display.FromFixedPoint<int32_t, float, 2>(data);
     ExtUI::setAxisSteps_per_mm(value, ExtUI::axis_t::Z);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::StepsPerMmE(DGUS_VP &vp, void *data_ptr) {
@@ -1215,8 +1257,7 @@
     const float value  = dgus_display.FromFixedPoint<int32_t, float, 2>(data);
     ExtUI::setAxisSteps_per_mm(value, ExtUI::extruder_t::E0);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::JerkStepsMmX(DGUS_VP &vp, void *data_ptr) {
@@ -1225,8 +1266,7 @@
       const float value  = dgus_display.FromFixedPoint<int16_t, float, 1>(data);
       ExtUI::setAxisMaxJerk_mm_s(value, ExtUI::axis_t::X);
 
-      settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+      dgus_screen_handler.TriggerEEPROMSave();
     #else
     #endif
   }
@@ -1234,11 +1274,10 @@
   void DGUSRxHandler::JerkStepsMmY(DGUS_VP &vp, void *data_ptr) {
     #if ENABLED(CLASSIC_JERK)
       const int16_t data = Swap16(*(int16_t *)data_ptr);
-      const float value  = dgus_display.FromFixedPoint < int16_t
-
-        settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);, float, 1>(data);
+      const float value  = dgus_display.FromFixedPoint<int16_t, float, 1>(data);
       ExtUI::setAxisMaxJerk_mm_s(value, ExtUI::axis_t::Y);
+
+      dgus_screen_handler.TriggerEEPROMSave();
     #else
     #endif
   }
@@ -1249,8 +1288,7 @@
       const float value  = dgus_display.FromFixedPoint<int16_t, float, 1>(data);
       ExtUI::setAxisMaxJerk_mm_s(value, ExtUI::axis_t::Z);
 
-      settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+      dgus_screen_handler.TriggerEEPROMSave();
     #else
     #endif
   }
@@ -1261,8 +1299,7 @@
       const float value  = dgus_display.FromFixedPoint<int16_t, float, 1>(data);
       ExtUI::setAxisMaxJerk_mm_s(value, ExtUI::extruder_t::E0);
 
-      settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+      dgus_screen_handler.TriggerEEPROMSave();
     #else
     #endif
   }
@@ -1273,8 +1310,7 @@
       const float value  = dgus_display.FromFixedPoint<int16_t, float, 3>(data);
       ExtUI::setJunctionDeviation_mm(value);
 
-      settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+      dgus_screen_handler.TriggerEEPROMSave();
     #else
       dgus_screen_handler.SetStatusMessagePGM(DGUS_MSG_FEATURE_NOT_ENABLED);
     #endif
@@ -1286,8 +1322,7 @@
       const float value  = dgus_display.FromFixedPoint<int16_t, float, 2>(data);
       ExtUI::setLinearAdvance_mm_mm_s(value, ExtUI::extruder_t::E0);
 
-      settings.save();
-      // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+      dgus_screen_handler.TriggerEEPROMSave();
     #else
       dgus_screen_handler.SetStatusMessagePGM(DGUS_MSG_FEATURE_NOT_ENABLED);
     #endif
@@ -1298,8 +1333,7 @@
     const float value  = dgus_display.FromFixedPoint<int16_t, float, 0>(data);
     ExtUI::setAxisMaxAcceleration_mm_s2(value, ExtUI::axis_t::X);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::AccelerationY(DGUS_VP &vp, void *data_ptr) {
@@ -1307,8 +1341,7 @@
     const float value  = dgus_display.FromFixedPoint<int16_t, float, 0>(data);
     ExtUI::setAxisMaxAcceleration_mm_s2(value, ExtUI::axis_t::Y);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::AccelerationZ(DGUS_VP &vp, void *data_ptr) {
@@ -1316,8 +1349,7 @@
     const float value  = dgus_display.FromFixedPoint<int16_t, float, 0>(data);
     ExtUI::setAxisMaxAcceleration_mm_s2(value, ExtUI::axis_t::Z);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::AccelerationE(DGUS_VP &vp, void *data_ptr) {
@@ -1325,8 +1357,7 @@
     const float value  = dgus_display.FromFixedPoint<int16_t, float, 0>(data);
     ExtUI::setAxisMaxAcceleration_mm_s2(value, ExtUI::extruder_t::E0);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::AccelerationPrint(DGUS_VP &vp, void *data_ptr) {
@@ -1334,8 +1365,7 @@
     const float value  = dgus_display.FromFixedPoint<int16_t, float, 0>(data);
     ExtUI::setPrintingAcceleration_mm_s2(value);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::AccelerationRetract(DGUS_VP &vp, void *data_ptr) {
@@ -1343,8 +1373,7 @@
     const float value  = dgus_display.FromFixedPoint<int16_t, float, 0>(data);
     ExtUI::setRetractAcceleration_mm_s2(value);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::AccelerationTravel(DGUS_VP &vp, void *data_ptr) {
@@ -1352,8 +1381,7 @@
     const float value  = dgus_display.FromFixedPoint<int16_t, float, 0>(data);
     ExtUI::setTravelAcceleration_mm_s2(value);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::MaxFeedRateX(DGUS_VP &vp, void *data_ptr) {
@@ -1361,8 +1389,7 @@
     const feedRate_t value = dgus_display.FromFixedPoint<int16_t, feedRate_t, 0>(data);
     ExtUI::setAxisMaxFeedrate_mm_s(value, ExtUI::axis_t::X);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::MaxFeedRateY(DGUS_VP &vp, void *data_ptr) {
@@ -1370,8 +1397,7 @@
     const feedRate_t value = dgus_display.FromFixedPoint<int16_t, feedRate_t, 0>(data);
     ExtUI::setAxisMaxFeedrate_mm_s(value, ExtUI::axis_t::Y);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::MaxFeedRateZ(DGUS_VP &vp, void *data_ptr) {
@@ -1379,8 +1405,7 @@
     const feedRate_t value = dgus_display.FromFixedPoint<int16_t, feedRate_t, 0>(data);
     ExtUI::setAxisMaxFeedrate_mm_s(value, ExtUI::axis_t::Z);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::MaxFeedRateE(DGUS_VP &vp, void *data_ptr) {
@@ -1388,8 +1413,7 @@
     const feedRate_t value = dgus_display.FromFixedPoint<int16_t, feedRate_t, 0>(data);
     ExtUI::setAxisMaxFeedrate_mm_s(value, ExtUI::extruder_t::E0);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::MinPrintFeedRate(DGUS_VP &vp, void *data_ptr) {
@@ -1397,8 +1421,7 @@
     const feedRate_t value = dgus_display.FromFixedPoint<int16_t, feedRate_t, 1>(data);
     ExtUI::setMinFeedrate_mm_s(value);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::MinTravelFeedRate(DGUS_VP &vp, void *data_ptr) {
@@ -1406,8 +1429,7 @@
     const feedRate_t value = dgus_display.FromFixedPoint<int16_t, feedRate_t, 1>(data);
     ExtUI::setMinTravelFeedrate_mm_s(value);
 
-    settings.save();
-    // queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
+    dgus_screen_handler.TriggerEEPROMSave();
   }
 
   void DGUSRxHandler::Debug(DGUS_VP &vp, void *data_ptr) {
@@ -1420,10 +1442,18 @@
       dgus_screen_handler.TriggerScreenChange(DGUS_Screen::DEBUG);
   }
 
+  void DGUSRxHandler::DumpStats(DGUS_VP &vp, void *data_ptr) {
+    UNUSED(vp);
+    UNUSED(data_ptr);
+
+    dgus_display.DumpStats();
+  }
+
   void DGUSRxHandler::StringToExtra(DGUS_VP &vp, void *data_ptr) {
-    if (!vp.size || !vp.extra)
+    if (!vp.extra)
       return;
-    memcpy(vp.extra, data_ptr, vp.size);
+    memcpy(vp.extra, data_ptr, vp.size); // An empty string clears the text
+    ((char *)vp.extra)[vp.size] = '\0';
   }
 
 #endif // DGUS_LCD_UI_RELOADED
@@ -33,6 +33,8 @@ namespace DGUSRxHandler {
     void Scroll(DGUS_VP &, void *);
     void SelectFile(DGUS_VP &, void *);
     void PrintFile(DGUS_VP &, void *);
+    void SortFiles(DGUS_VP &, void *);
+    void FileFilter(DGUS_VP &, void *);
   #endif
 
   void PrintAbort(DGUS_VP &, void *);
@@ -122,6 +124,7 @@ namespace DGUSRxHandler {
   void MinTravelFeedRate(DGUS_VP &, void *);
 
   void Debug(DGUS_VP &, void *);
+  void DumpStats(DGUS_VP &, void *);
 
   void StringToExtra(DGUS_VP &, void *);
 
@@ -28,16 +28,28 @@
 
   #include "DGUSDisplay.h"
   #include "definition/DGUS_ScreenAddrList.h"
+  #include "definition/DGUS_VPList.h"
   #include "definition/DGUS_ScreenSetup.h"
+  #if ENABLED(SDSUPPORT)
+    #include "DGUSFileIndex.h"
+  #endif
 
   #include "../../../gcode/queue.h"
+  #include "../../../MarlinCore.h"
 
   uint8_t DGUSScreenHandler::debug_count = 0;
+  uint16_t DGUSScreenHandler::save_requests = 0;
+  uint16_t DGUSScreenHandler::saves         = 0;
 
   #if ENABLED(SDSUPPORT)
     ExtUI::FileList DGUSScreenHandler::filelist;
     uint16_t DGUSScreenHandler::filelist_offset  = 0;
     int16_t DGUSScreenHandler::filelist_selected = -1;
+    DGUSScreenHandler::file_entry_t DGUSScreenHandler::file_page[DGUS_FILE_COUNT];
+    DGUSScreenHandler::file_entry_t DGUSScreenHandler::file_selected;
+    char DGUSScreenHandler::file_filter[]          = "";
+    bool DGUSScreenHandler::filter_searching       = false;
+    uint16_t DGUSScreenHandler::filter_matches     = 0;
   #endif
 
   DGUS_Data::StepSize DGUSScreenHandler::offset_steps = DGUS_Data::StepSize::MMP1;
@@ -62,6 +74,17 @@
   DGUS_Screen DGUSScreenHandler::new_screen     = DGUS_Screen::BOOT;
   bool DGUSScreenHandler::full_update           = false;
 
+  millis_t DGUSScreenHandler::update_due[DGUS_RATE_COUNT] = { 0 };
+  DGUSScreenHandler::upload_t DGUSScreenHandler::upload       = { DGUS_Screen::BOOT, UPLOAD_DONE, 0, 0, false, false, false };
+
+  millis_t DGUSScreenHandler::heartbeat_ms      = 0;
+  uint8_t DGUSScreenHandler::heartbeat_missed   = 0;
+  uint8_t DGUSScreenHandler::screen_switches    = 0;
+  uint8_t DGUSScreenHandler::heartbeat_switches = 0;
+  bool DGUSScreenHandler::resync                = false;
+  uint8_t DGUSScreenHandler::dirty_vps[(DGUS_VP_NONE + 7) / 8] = { 0 };
+  bool DGUSScreenHandler::has_dirty_vps                       = false;
+
   DGUS_Screen DGUSScreenHandler::wait_return_screen = DGUS_Screen::HOME;
   bool DGUSScreenHandler::wait_continue             = false;
 
@@ -70,6 +93,9 @@
   millis_t DGUSScreenHandler::status_expire = 0;
   millis_t DGUSScreenHandler::eeprom_save   = 0;
 
+  uint8_t DGUSScreenHandler::settings_log[ExtUI::eeprom_data_size] = { 0 };
+  uint8_t DGUSScreenHandler::settings_head                         = SETTINGS_RECORDS;
+
   #define en      1
   #define fr      2
   #define fr_na   2
@@ -124,8 +150,25 @@
     if (!settings_ready || current_screen == DGUS_Screen::KILL)
       return;
 
-    const millis_t ms             = ExtUI::safe_millis();
-    static millis_t next_event_ms = 0;
+    // Input first, whatever else this pass does
+    dgus_display.Loop();
+
+    // Nothing gets through while looking for the link speed, e.g. the settings loaded meanwhile.
+    // Once it is found, resend brightness, volume and the current screen.
+    if (dgus_display.IsProbing()) {
+      resync = true;
+      return;
+    }
+
+    const millis_t ms = ExtUI::safe_millis();
+
+    if (resync) {
+      resync = false;
+      Resync();
+      return;
+    }
+
+    Heartbeat(ms);
 
     if (new_screen != DGUS_Screen::BOOT) {
       const DGUS_Screen screen = new_screen;
@@ -146,11 +189,15 @@
       return;
     }
 
-    if (ELAPSED(ms, next_event_ms) || full_update) {
-      next_event_ms = ms + DGUS_UPDATE_INTERVAL_MS;
+    if (upload.pass != UPLOAD_DONE) {
+      SendScreenVPData();
+      return;
+    }
 
-      if (!SendScreenVPData(current_screen, full_update))
-        DEBUG_ECHOLNPGM("SendScreenVPData failed");
+    const uint8_t rates = DueUpdateRates(ms);
+    if (rates || full_update || has_dirty_vps) {
+      StartScreenVPData(current_screen, full_update, rates);
+      SendScreenVPData();
       return;
     }
 
@@ -184,12 +231,24 @@
 
     if (eeprom_save > 0 && ELAPSED(ms, eeprom_save) && IsPrinterIdle()) {
       eeprom_save = 0;
+      if (saves < 0xFFFF) saves++;
+
+      DEBUG_ECHOLNPAIR_F("Settings saved, requests: ", save_requests, " saves: ", saves);
 
       queue.enqueue_now_P(DGUS_CMD_EEPROM_SAVE);
       return;
     }
 
-    dgus_display.Loop();
+    #if ENABLED(SDSUPPORT)
+      // Show the sorted listing as soon as its index is ready
+      if (current_screen == DGUS_Screen::PRINT) {
+        if (DGUSFileIndex::Loop()) {
+          RefreshFilePage();
+          TriggerFullUpdate();
+        }
+        FilterFiles();
+      }
+    #endif
   }
 
   void DGUSScreenHandler::PrinterKilled(FSTR_P const error, FSTR_P const component) {
@@ -201,6 +260,12 @@
     dgus_display.PlaySound(3, 1, 200);
 
     MoveToScreen(DGUS_Screen::KILL, true);
+
+    // Loop() is not called anymore, finish the screen here
+    while (!SendScreenVPData()) {
+      dgus_display.FlushTx();
+      dgus_display.ProcessAcksOnly();
+    }
   }
 
   void DGUSScreenHandler::UserConfirmRequired(const char *const msg) {
@@ -215,6 +280,8 @@
   }
 
   void DGUSScreenHandler::SettingsReset() {
+    eeprom_save = 0;
+
     dgus_display.SetVolume(DGUS_DEFAULT_VOLUME);
     dgus_display.SetBrightness(DGUS_DEFAULT_BRIGHTNESS);
 
@@ -228,38 +295,109 @@
   }
 
   void DGUSScreenHandler::StoreSettings(char *buff) {
-    eeprom_data_t data;
+    static_assert(SETTINGS_RECORDS >= 2, "eeprom_data_size too small for the DGUS settings log.");
 
-    static_assert(sizeof(data) <= ExtUI::eeprom_data_size, "sizeof(eeprom_data_t) > eeprom_data_size.");
+    // Whoever saved, a deferred save would write the same data again
+    eeprom_save = 0;
 
-    data.initialized = true;
-    data.volume      = dgus_display.GetVolume();
-    data.brightness  = dgus_display.GetBrightness();
+    settings_record_t record;
+    record.volume     = dgus_display.GetVolume();
+    record.brightness = dgus_display.GetBrightness();
+    record.flags      = SETTINGS_VERSION << 4;
     #if HAS_LEVELING
-      data.abl = (ExtUI::getLevelingActive() && ExtUI::getMeshValid());
+      if (ExtUI::getLevelingActive() && ExtUI::getMeshValid())
+        record.flags |= SETTINGS_FLAG_ABL;
     #endif
-    memcpy(buff, &data, sizeof(data));
+
+    settings_record_t last;
+    const bool changed = !(settings_head < SETTINGS_RECORDS && ReadSettingsRecord(settings_head, last))
+                         || last.volume != record.volume
+                         || last.brightness != record.brightness
+                         || last.flags != record.flags;
+
+    // Unchanged settings leave the slot as it is, so the EEPROM bytes are not rewritten
+    if (changed) {
+      record.seq = settings_head < SETTINGS_RECORDS ? last.seq + 1 : 0;
+      record.crc = dgus_display.CRC16((const uint8_t *)&record, offsetof(settings_record_t, crc));
+
+      settings_head = settings_head < SETTINGS_RECORDS - 1 ? settings_head + 1 : 0;
+      memcpy(&settings_log[settings_head * sizeof(record)], &record, sizeof(record));
+    }
+
+    memcpy(buff, settings_log, sizeof(settings_log));
   }
 
   void DGUSScreenHandler::LoadSettings(const char *buff) {
-    eeprom_data_t data;
+    memcpy(settings_log, buff, sizeof(settings_log));
 
-    static_assert(sizeof(data) <= ExtUI::eeprom_data_size, "sizeof(eeprom_data_t) > eeprom_data_size.");
+    eeprom_save = 0;
 
-    memcpy(&data, buff, sizeof(data));
+    settings_record_t newest, record;
+    settings_head = SETTINGS_RECORDS;
 
-    dgus_display.SetVolume(data.initialized ? data.volume : DGUS_DEFAULT_VOLUME);
-    dgus_display.SetBrightness(data.initialized ? data.brightness : DGUS_DEFAULT_BRIGHTNESS);
+    LOOP_L_N(i, SETTINGS_RECORDS) {
+      if (!ReadSettingsRecord(i, record)) continue;
 
-    #if HAS_LEVELING
-      if (data.initialized) {
-        leveling_active = (data.abl && ExtUI::getMeshValid());
+      if (settings_head == SETTINGS_RECORDS || (int8_t)(record.seq - newest.seq) > 0) {
+        newest = record;
+        settings_head = i;
+      }
+    }
 
-        ExtUI::setLevelingActive(leveling_active);
+    if (settings_head == SETTINGS_RECORDS) {
+      eeprom_data_t data;
+
+      if (!ReadLegacySettings(buff, data)) {
+        dgus_display.SetVolume(DGUS_DEFAULT_VOLUME);
+        dgus_display.SetBrightness(DGUS_DEFAULT_BRIGHTNESS);
+        return;
       }
+
+      // Settings stored by an older version; the first record written replaces them
+      DEBUG_ECHOLNPGM("Migrating settings");
+
+      newest.volume     = data.volume;
+      newest.brightness = data.brightness;
+      newest.flags      = data.abl ? SETTINGS_FLAG_ABL : 0;
+    }
+
+    dgus_display.SetVolume(newest.volume);
+    dgus_display.SetBrightness(newest.brightness);
+
+    #if HAS_LEVELING
+      leveling_active = ((newest.flags & SETTINGS_FLAG_ABL) && ExtUI::getMeshValid());
+
+      ExtUI::setLevelingActive(leveling_active);
     #endif
   }
 
+  bool DGUSScreenHandler::ReadLegacySettings(const char *buff, eeprom_data_t &data) {
+    static_assert(sizeof(data) <= ExtUI::eeprom_data_size, "sizeof(eeprom_data_t) > eeprom_data_size.");
+
+    // Only as the old StoreSettings() wrote it: initialized exactly 1, percentages, abl 0 or 1 (left
+    // unset without leveling) and the rest of the slot as Marlin handed it over, zero-filled
+    const uint8_t *bytes = (const uint8_t *)buff;
+    if (bytes[0] != 1 || bytes[1] > 100 || bytes[2] > 100 || (ENABLED(HAS_LEVELING) && bytes[3] > 1))
+      return false;
+
+    for (uint8_t i = sizeof(data); i < ExtUI::eeprom_data_size; i++)
+      if (bytes[i]) return false;
+
+    data.initialized = true;
+    data.volume      = bytes[1];
+    data.brightness  = bytes[2];
+    data.abl         = bytes[3];
+    return true;
+  }
+
+  bool DGUSScreenHandler::ReadSettingsRecord(uint8_t index, settings_record_t &record) {
+    memcpy(&record, &settings_log[index * sizeof(record)], sizeof(record));
+
+    if ((record.flags >> 4) != SETTINGS_VERSION) return false;
+
+    return dgus_display.CRC16((const uint8_t *)&record, offsetof(settings_record_t, crc)) == record.crc;
+  }
+
   void DGUSScreenHandler::ConfigurationStoreWritten(bool success) {
     if (!success)
       SetStatusMessagePGM(DGUS_MSG_EEPROM_FAILED);
@@ -340,7 +478,8 @@
         probing_icons[1] = 0;
       }
 
-      TriggerFullUpdate();
+      TriggerVPUpdate(DGUS_Addr::LEVEL_AUTO_Grid);
+      TriggerVPUpdate(DGUS_Addr::SP_LEVEL_AUTO_Grid);
     }
 
   #endif
@@ -352,7 +491,7 @@
   void DGUSScreenHandler::PrintTimerPaused() {
     dgus_display.PlaySound(3);
 
-    TriggerFullUpdate();
+    TriggerVPUpdate(DGUS_Addr::STATUS_Pause_Resume_Icon);
   }
 
   void DGUSScreenHandler::PrintTimerStopped() {
@@ -384,17 +523,115 @@
     }
 
     void DGUSScreenHandler::SDCardRemoved() {
+      filelist_selected = -1;
+      DGUSFileIndex::Reset();
+
       if (current_screen == DGUS_Screen::PRINT)
         TriggerScreenChange(DGUS_Screen::HOME);
     }
 
     void DGUSScreenHandler::SDCardError() {
+      filelist_selected = -1;
+      DGUSFileIndex::Reset();
+
       SetStatusMessagePGM(GET_TEXT(MSG_MEDIA_READ_ERROR));
 
       if (current_screen == DGUS_Screen::PRINT)
         TriggerScreenChange(DGUS_Screen::HOME);
     }
 
+    void DGUSScreenHandler::RefreshFilePage() {
+      filter_searching = false;
+
+      if (file_filter[0]) {
+        LOOP_L_N(i, DGUS_FILE_COUNT) {
+          file_page[i].type          = DGUS_Data::SDType::NONE;
+          file_page[i].name[0]       = '\0';
+          file_page[i].short_name[0] = '\0';
+        }
+
+        // The matches are filled in by FilterFiles()
+        filter_matches   = 0;
+        filter_searching = true;
+        DGUSFileIndex::Rewind();
+        return;
+      }
+
+      if (DGUSFileIndex::ReadPage(filelist_offset, file_page))
+        return;
+
+      LOOP_L_N(i, DGUS_FILE_COUNT) {
+        file_entry_t &entry = file_page[i];
+
+        if (!filelist.seek(filelist_offset + i)) {
+          entry.type          = DGUS_Data::SDType::NONE;
+          entry.name[0]       = '\0';
+          entry.short_name[0] = '\0';
+          continue;
+        }
+
+        entry.type = filelist.isDir() ? DGUS_Data::SDType::DIRECTORY : DGUS_Data::SDType::FILE;
+        strncpy(entry.name, filelist.filename(), sizeof(entry.name) - 1);
+        entry.name[sizeof(entry.name) - 1] = '\0';
+        strncpy(entry.short_name, filelist.shortFilename(), sizeof(entry.short_name) - 1);
+        entry.short_name[sizeof(entry.short_name) - 1] = '\0';
+      }
+    }
+
+    uint16_t DGUSScreenHandler::FileCount() {
+      if (file_filter[0]) return filter_matches;
+      return DGUSFileIndex::IsReady() ? DGUSFileIndex::Count() : filelist.count();
+    }
+
+    // Case-insensitive substring search
+    static bool NameContains(const char *name, const char *const text) {
+      const size_t len = strlen(text);
+      for (; *name; name++)
+        if (!strncasecmp(name, text, len)) return true;
+      return false;
+    }
+
+    void DGUSScreenHandler::FilterFiles() {
+      if (!filter_searching) return;
+
+      // The card belongs to the print job
+      if (printingIsActive() || printingIsPaused()) return;
+
+      static constexpr DGUS_Addr name_addr[DGUS_FILE_COUNT] = {
+        DGUS_Addr::SD_FileName0,
+        DGUS_Addr::SD_FileName1,
+        DGUS_Addr::SD_FileName2,
+        DGUS_Addr::SD_FileName3,
+        DGUS_Addr::SD_FileName4
+      };
+
+      const millis_t start = ExtUI::safe_millis();
+      file_entry_t entry;
+      char longname[LONG_FILENAME_LENGTH];
+
+      do {
+        if (!DGUSFileIndex::Next(entry, longname)) {
+          filter_searching = false;
+          TriggerVPUpdate(DGUS_Addr::SD_ScrollIcons);
+          return;
+        }
+
+        if (!NameContains(longname, file_filter)) continue;
+
+        if (filter_matches >= filelist_offset && filter_matches < filelist_offset + DGUS_FILE_COUNT) {
+          const uint8_t slot = filter_matches - filelist_offset;
+          file_page[slot] = entry;
+          TriggerVPUpdate(DGUS_Addr::SD_Type);
+          TriggerVPUpdate(name_addr[slot]);
+        }
+        else if (filter_matches == filelist_offset + DGUS_FILE_COUNT) {
+          TriggerVPUpdate(DGUS_Addr::SD_ScrollIcons); // There is a next page
+        }
+
+        filter_matches++;
+      } while (PENDING(ExtUI::safe_millis(), start + DGUS_FILE_INDEX_MS));
+    }
+
   #endif // SDSUPPORT
 
   #if ENABLED(POWER_LOSS_RECOVERY)
@@ -413,6 +650,9 @@
           break;
         case ExtUI::PID_DONE:
           SetStatusMessagePGM(GET_TEXT(MSG_PID_AUTOTUNE_DONE));
+          TriggerVPUpdate(DGUS_Addr::PID_Kp);
+          TriggerVPUpdate(DGUS_Addr::PID_Ki);
+          TriggerVPUpdate(DGUS_Addr::PID_Kd);
           break;
         case ExtUI::PID_BAD_EXTRUDER_NUM:
           SetStatusMessagePGM(GET_TEXT(MSG_PID_BAD_EXTRUDER_NUM));
@@ -641,12 +881,22 @@
     new_screen = screen;
   }
 
+  void DGUSScreenHandler::TriggerVPUpdate(DGUS_Addr addr) {
+    const uint8_t index = DGUS_FindVP(addr);
+    if (index == DGUS_VP_NONE) return;
+
+    SBI(dirty_vps[index >> 3], index & 7);
+    has_dirty_vps = true;
+  }
+
   void DGUSScreenHandler::TriggerFullUpdate() {
     full_update = true;
   }
 
   void DGUSScreenHandler::TriggerEEPROMSave() {
-    eeprom_save = ExtUI::safe_millis() + 500;
+    // Every change restarts the wait, so a burst of changes is written once
+    eeprom_save = ExtUI::safe_millis() + DGUS_EEPROM_SAVE_DELAY_MS;
+    if (save_requests < 0xFFFF) save_requests++;
   }
 
   bool DGUSScreenHandler::IsPrinterIdle() {
@@ -654,32 +904,22 @@
             && !ExtUI::isMoving());
   }
 
-  const DGUS_Addr *DGUSScreenHandler::FindScreenAddrList(DGUS_Screen screen) {
-    DGUS_ScreenAddrList list;
-    const DGUS_ScreenAddrList *map = screen_addr_list_map;
+  bool DGUSScreenHandler::FindScreenVPList(DGUS_Screen screen, DGUS_ScreenVPList *const lists) {
+    const uint8_t index = DGUS_ScreenIndex(screen);
+    if (index >= DGUS_SCREEN_COUNT) return false;
 
-    do {
-      memcpy_P(&list, map, sizeof(*map));
-      if (!list.addr_list) break;
-      if (list.screen == screen)
-        return list.addr_list;
-    } while (++map);
-
-    return nullptr;
+    memcpy_P(lists, &screen_vp_map.screen[index], sizeof(*lists));
+    return lists->auto_list != nullptr;
   }
 
   bool DGUSScreenHandler::CallScreenSetup(DGUS_Screen screen) {
-    DGUS_ScreenSetup setup;
-    const DGUS_ScreenSetup *list = screen_setup_list;
+    const uint8_t index = DGUS_ScreenIndex(screen);
+    if (index >= DGUS_SCREEN_COUNT) return true;
 
-    do {
-      memcpy_P(&setup, list, sizeof(*list));
-      if (!setup.setup_fn) break;
-      if (setup.screen == screen)
-        return setup.setup_fn();
-    } while (++list);
+    bool (*setup_fn)(void);
+    memcpy_P(&setup_fn, &screen_setup_map.setup_fn[index], sizeof(setup_fn));
 
-    return true;
+    return setup_fn ? setup_fn() : true;
   }
 
   void DGUSScreenHandler::MoveToScreen(DGUS_Screen screen, bool abort_wait) {
@@ -698,45 +938,161 @@
 
     if (!CallScreenSetup(screen)) return;
 
-    if (!SendScreenVPData(screen, true)) {
-      DEBUG_ECHOLNPGM("SendScreenVPData failed");
-      return;
-    }
+    dgus_display.InvalidateShadow();
 
-    DEBUG_ECHOLNPAIR_F("From screen ", (uint16_t)current_screen, " to screen ", (uint16_t)screen);
-    current_screen = screen;
-    dgus_display.SwitchScreen(current_screen);
+    // The display switches once the screen data is sent, possibly over several Loop() calls
+    StartScreenVPData(screen, true);
+    upload.switch_screen = true;
+    SendScreenVPData();
   }
 
-  bool DGUSScreenHandler::SendScreenVPData(DGUS_Screen screen, bool complete_update) {
+  uint8_t DGUSScreenHandler::DueUpdateRates(const millis_t ms) {
+    static constexpr millis_t interval[DGUS_RATE_COUNT] = {
+      DGUS_UPDATE_INTERVAL_MS,  // DGUS_RATE_NORMAL
+      DGUS_UPDATE_FAST_MS,      // DGUS_RATE_FAST
+      DGUS_UPDATE_SLOW_MS       // DGUS_RATE_SLOW
+    };
+
+    uint8_t rates = 0;
+    LOOP_L_N(rate, DGUS_RATE_COUNT) {
+      if (PENDING(ms, update_due[rate])) continue;
+      update_due[rate] = ms + interval[rate];
+      SBI(rates, rate);
+    }
+    return rates;
+  }
+
+  void DGUSScreenHandler::StartScreenVPData(DGUS_Screen screen, bool complete_update, uint8_t rates) {
     if (complete_update)
       full_update = false;
 
-    const DGUS_Addr *list = FindScreenAddrList(screen);
+    upload.screen        = screen;
+    upload.pass          = 0;
+    upload.pos           = 0;
+    upload.rates         = rates;
+    upload.complete      = complete_update;
+    upload.dirty         = has_dirty_vps;
+    upload.switch_screen = false;
 
-    while (true) {
-      if (!list) return true;                                             // Nothing left to send
+    has_dirty_vps = false;
+  }
 
-      const uint16_t addr = pgm_read_word(list++);
-      if (!addr) return true;                                             // Nothing left to send
+  void DGUSScreenHandler::Heartbeat(const millis_t ms) {
+    if (PENDING(ms, heartbeat_ms)) return;
+    heartbeat_ms = ms + DGUS_HEARTBEAT_MS;
 
-      DGUS_VP vp;
-      if (!DGUS_PopulateVP((DGUS_Addr)addr, &vp)) continue;               // Invalid VP
-      if (!vp.tx_handler) continue;                                       // Nothing to send
-      if (!complete_update && !(vp.flags & VPFLAG_AUTOUPLOAD)) continue;  // Unnecessary VP
+    // DGUS_READ_TIMEOUT_MS is shorter than DGUS_HEARTBEAT_MS, so only one heartbeat is outstanding
+    heartbeat_switches = screen_switches;
+    dgus_display.ReadAsync(DGUSDisplay::DGUS_CURRENT_PAGE, 1, HeartbeatReceived);
+  }
 
-      uint8_t expected_tx      = 6 + vp.size;                             // 6 bytes header + payload.
-      const millis_t try_until = ExtUI::safe_millis() + 1000;
+  void DGUSScreenHandler::HeartbeatReceived(uint16_t addr, const uint8_t *data, uint8_t len) {
+    UNUSED(addr);
+
+    if (!data || len != 2) {
+      if (heartbeat_missed < 0xFF) heartbeat_missed++;
+      return;
+    }
 
-      while (expected_tx > dgus_display.GetFreeTxBuffer()) {
-        if (ELAPSED(ExtUI::safe_millis(), try_until)) return false;  // Stop trying after 1 second
+    const uint16_t page = data[0] << 8 | data[1];
+    // Read before the last screen switch, the page may still be the previous one
+    const bool stale = heartbeat_switches != screen_switches;
 
-        dgus_display.FlushTx();                                      // Flush the TX buffer
-        delay(50);
+    // Back after being silent, or showing the boot page again: everything we sent is lost
+    if (heartbeat_missed >= DGUS_HEARTBEAT_LOST
+        || (!stale && page == (uint16_t)DGUS_Screen::BOOT && current_screen != DGUS_Screen::BOOT)
+        ) resync = true;
+
+    heartbeat_missed = 0;
+  }
+
+  void DGUSScreenHandler::Resync() {
+    DEBUG_ECHOLNPGM("Display reset, resync");
+
+    dgus_display.Resync();
+    heartbeat_missed = 0; // Misses before the reset must not trigger another one
+
+    // Same as entering the screen, without running its setup again
+    const DGUS_Screen screen = upload.pass != UPLOAD_DONE && upload.switch_screen ? upload.screen : current_screen;
+    StartScreenVPData(screen, true);
+    upload.switch_screen = true;
+    SendScreenVPData();
+  }
+
+  bool DGUSScreenHandler::SendScreenVPData() {
+    if (upload.pass == UPLOAD_DONE) return true;
+
+    DGUS_ScreenVPList lists;
+    if (!FindScreenVPList(upload.screen, &lists))
+      upload.pass = UPLOAD_DONE;                                          // Nothing to send
+
+    int16_t budget = DGUS_UPDATE_BUDGET;
+
+    // Refreshes yield to interactive writes, entering a screen is interactive itself
+    dgus_display.SetBackground(!upload.switch_screen);
+    dgus_display.StartBatch();
+
+    // Auto-upload VPs first, then the ones only sent on complete updates
+    while (upload.pass < (upload.complete || upload.dirty ? 2 : 1)) {
+      const uint8_t *list = upload.pass ? lists.full_list : lists.auto_list;
+      const uint8_t index = pgm_read_byte(&list[upload.pos]);
+
+      if (index == DGUS_VP_NONE) {                                        // End of this list
+        upload.pass++;
+        upload.pos = 0;
+        continue;
       }
 
+      DGUS_VP vp;
+      memcpy_P(&vp, &vp_list[index], sizeof(vp));
+
+      if (!upload.complete
+          && !TEST(dirty_vps[index >> 3], index & 7)
+          && (upload.pass || !TEST(upload.rates, DGUS_VPRate(vp.flags)))
+          ) {
+        upload.pos++;
+        continue;                                                         // Unchanged and not due
+      }
+
+      const uint8_t expected_tx = 6 + vp.size;                            // 6 bytes header + payload.
+      const size_t free_tx      = dgus_display.GetFreeTxBuffer();
+
+      if (!free_tx) break;                                                // The display is still busy
+
+      // Always make progress, otherwise resume on the next call
+      if (budget < DGUS_UPDATE_BUDGET
+          && (expected_tx > budget || expected_tx > free_tx)
+          ) break;
+
+      budget -= expected_tx;
+      upload.pos++;
+      CBI(dirty_vps[index >> 3], index & 7);
+
+      dgus_display.SetDeadband(vp.deadband);
       vp.tx_handler(vp);
+      dgus_display.SetDeadband(0);
+    }
+
+    dgus_display.EndBatch();
+    dgus_display.SetBackground(false);
+
+    if (upload.pass < (upload.complete || upload.dirty ? 2 : 1))
+      return false;
+
+    upload.pass = UPLOAD_DONE;
+
+    // VPs flagged during the upload are sent next time. The others belong to other screens,
+    // which are sent completely when entering them.
+    if (!has_dirty_vps) ZERO(dirty_vps);
+
+    if (upload.switch_screen) {
+      DEBUG_ECHOLNPAIR_F("From screen ", (uint16_t)current_screen, " to screen ", (uint16_t)upload.screen);
+      current_screen = upload.screen;
+      dgus_display.SwitchScreen(current_screen);
+      screen_switches++;
     }
+
+    return true;
   }
 
 #endif // DGUS_LCD_UI_RELOADED
@@ -26,6 +26,8 @@
 #include "config/DGUS_Data.h"
 #include "config/DGUS_Screen.h"
 #include "config/DGUS_Constants.h"
+#include "definition/DGUS_ScreenAddrList.h"
+#include "definition/DGUS_VP.h"
 
 #include "../ui_api.h"
 #include "../../../inc/MarlinConfigPre.h"
@@ -84,6 +86,8 @@ class DGUSScreenHandler {
 
     static DGUS_Screen GetCurrentScreen();
     static void TriggerScreenChange(DGUS_Screen screen);
+    // Send a single VP on the next update, e.g. after its value was changed.
+    static void TriggerVPUpdate(DGUS_Addr addr);
     static void TriggerFullUpdate();
 
     static void TriggerEEPROMSave();
@@ -93,11 +97,34 @@ class DGUSScreenHandler {
     static void MoveToLevelPoint();
 
     static uint8_t debug_count;
+    // Settings changes requested from the display vs. saves actually done
+    static uint16_t save_requests;
+    static uint16_t saves;
 
     #if ENABLED(SDSUPPORT)
       static ExtUI::FileList filelist;
       static uint16_t filelist_offset;
       static int16_t filelist_selected;
+
+      // Entries shown on the PRINT screen, read from the card once per page instead of once per VP
+      struct file_entry_t {
+        DGUS_Data::SDType type;
+        char name[DGUS_FILENAME_LEN + 1]; // As displayed, cut to fit
+        char short_name[13];              // 8.3 name, used to open the file
+      };
+
+      static file_entry_t file_page[DGUS_FILE_COUNT];
+      static file_entry_t file_selected;
+      // Read the page at filelist_offset. Call after changing the directory or the offset.
+      static void RefreshFilePage();
+      // Entries in the current directory, as counted by the index once it is ready
+      static uint16_t FileCount();
+
+      // With a filter set, the page lists the entries whose full long name contains it, not just
+      // the part shown on the screen. They are searched for DGUS_FILE_INDEX_MS per Loop() call and
+      // shown as they are found, but not while printing since the card belongs to the print job.
+      static char file_filter[DGUS_FILTER_LEN + 1];
+      static void FilterFiles();
     #endif
 
     static DGUS_Data::StepSize offset_steps;
@@ -120,11 +147,22 @@ class DGUSScreenHandler {
     static bool leveling_active;
 
   private:
-    static const DGUS_Addr *FindScreenAddrList(DGUS_Screen screen);
+    static bool FindScreenVPList(DGUS_Screen screen, DGUS_ScreenVPList *const lists);
     static bool CallScreenSetup(DGUS_Screen screen);
 
     static void MoveToScreen(DGUS_Screen screen, bool abort_wait=false);
-    static bool SendScreenVPData(DGUS_Screen screen, bool complete_update);
+    // Screen data is sent in slices of DGUS_UPDATE_BUDGET bytes, one per Loop() call.
+    static void StartScreenVPData(DGUS_Screen screen, bool complete_update, uint8_t rates=_BV(DGUS_RATE_COUNT) - 1);
+    // Send the next slice. Returns true once all data is sent.
+    static bool SendScreenVPData();
+    // Bitmask of the DGUS_UpdateRate classes whose deadline has passed; schedules their next update.
+    static uint8_t DueUpdateRates(const millis_t ms);
+
+    // Poll the page shown by the display to notice it was reset or reconnected.
+    static void Heartbeat(const millis_t ms);
+    static void HeartbeatReceived(uint16_t addr, const uint8_t *data, uint8_t len);
+    // Bring a reset display back to the current screen.
+    static void Resync();
 
     static bool settings_ready;
     static bool booted;
@@ -132,18 +170,69 @@ class DGUSScreenHandler {
     static DGUS_Screen current_screen;
     static DGUS_Screen new_screen;
     static bool full_update;
+    static millis_t update_due[DGUS_RATE_COUNT];
+    static uint8_t dirty_vps[(DGUS_VP_NONE + 7) / 8]; // Bit per vp_list index
+    static bool has_dirty_vps;
+
+    static constexpr uint8_t UPLOAD_DONE = 0xFF;
+
+    struct upload_t {
+      DGUS_Screen screen;
+      uint8_t pass;         // 0 = auto-upload list, 1 = full list, UPLOAD_DONE
+      uint8_t pos;          // Position in the current list
+      uint8_t rates;
+      bool complete;
+      bool dirty;
+      bool switch_screen;   // Switch to the screen once done
+    };
+
+    static upload_t upload;
+
+    static millis_t heartbeat_ms;
+    static uint8_t heartbeat_missed;
+    static uint8_t screen_switches;    // Counts SwitchScreen() calls, to spot answers older than the last one
+    static uint8_t heartbeat_switches; // screen_switches when the heartbeat was sent
+    static bool resync;
 
     static DGUS_Screen wait_return_screen;
 
     static millis_t status_expire;
     static millis_t eeprom_save;
 
+    #if ENABLED(SDSUPPORT)
+      static bool filter_searching;
+      static uint16_t filter_matches;     // Found so far
+    #endif
+
+    // Layout of the ExtUI slot before the settings log, only read to migrate it
     typedef struct {
       bool initialized;
       uint8_t volume;
       uint8_t brightness;
       bool abl;
     } eeprom_data_t;
+
+    // UI settings are appended as records to a log filling the ExtUI slot. A change only
+    // alters the bytes of one record, and successive changes rotate over the whole slot.
+    // The newest record with a valid CRC wins, so a corrupt record falls back to the one before.
+    typedef struct {
+      uint8_t seq;          // Incremented per record, wraps around
+      uint8_t volume;
+      uint8_t brightness;
+      uint8_t flags;        // Version in the high nibble, SETTINGS_FLAG_* below
+      uint16_t crc;
+    } settings_record_t;
+
+    static constexpr uint8_t SETTINGS_VERSION  = 2;
+    static constexpr uint8_t SETTINGS_FLAG_ABL = _BV(0);
+    static constexpr uint8_t SETTINGS_RECORDS  = ExtUI::eeprom_data_size / sizeof(settings_record_t);
+
+    static bool ReadSettingsRecord(uint8_t index, settings_record_t &record);
+    // Only if the slot positively holds the old layout
+    static bool ReadLegacySettings(const char *buff, eeprom_data_t &data);
+
+    static uint8_t settings_log[ExtUI::eeprom_data_size]; // Image of the slot as last loaded or stored
+    static uint8_t settings_head;                         // Index of the newest record, SETTINGS_RECORDS if none
 };
 
 extern DGUSScreenHandler dgus_screen_handler;
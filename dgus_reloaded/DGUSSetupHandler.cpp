@@ -28,6 +28,9 @@
 
   #include "DGUSDisplay.h"
   #include "DGUSScreenHandler.h"
+  #if ENABLED(SDSUPPORT)
+    #include "DGUSFileIndex.h"
+  #endif
 
   #include "../../../gcode/queue.h"
 
@@ -40,6 +43,9 @@
 
       dgus_screen_handler.filelist_offset   = 0;
       dgus_screen_handler.filelist_selected = -1;
+      ZERO(dgus_screen_handler.file_filter);
+      DGUSFileIndex::ChangeDir();
+      dgus_screen_handler.RefreshFilePage();
 
       return true;
     }
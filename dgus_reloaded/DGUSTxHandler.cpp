@@ -74,18 +74,11 @@
       uint16_t data[DGUS_FILE_COUNT];
 
       for (int i = 0; i < DGUS_FILE_COUNT; i++) {
-        if (!dgus_screen_handler.filelist.seek(dgus_screen_handler.filelist_offset + i)) {
-          data[i] = Swap16((uint16_t)DGUS_Data::SDType::NONE);
+        const DGUS_Data::SDType type = dgus_screen_handler.file_page[i].type;
 
-          SetFileControlState(i, false);
-          continue;
-        }
+        data[i] = Swap16((uint16_t)type);
 
-        data[i] = dgus_screen_handler.filelist.isDir() ?
-          Swap16((uint16_t)DGUS_Data::SDType::DIRECTORY)
-                : Swap16((uint16_t)DGUS_Data::SDType::FILE);
-
-        SetFileControlState(i, true);
+        SetFileControlState(i, type != DGUS_Data::SDType::NONE);
       }
 
       dgus_display.Write((uint16_t)vp.addr, data, sizeof(*data) * DGUS_FILE_COUNT);
@@ -113,10 +106,7 @@
           break;
       }
 
-      if (dgus_screen_handler.filelist.seek(dgus_screen_handler.filelist_offset + offset))
-        dgus_display.WriteString((uint16_t)vp.addr, dgus_screen_handler.filelist.filename(), vp.size);
-      else
-        dgus_display.WriteStringPGM((uint16_t)vp.addr, NUL_STR, vp.size);
+      dgus_display.WriteString((uint16_t)vp.addr, dgus_screen_handler.file_page[offset].name, vp.size);
     }
 
     void DGUSTxHandler::ScrollIcons(DGUS_VP &vp) {
@@ -148,7 +138,7 @@
           DGUS_Control::SCROLL_UP);
       }
 
-      if (dgus_screen_handler.filelist_offset + DGUS_FILE_COUNT < dgus_screen_handler.filelist.count()) {
+      if (dgus_screen_handler.filelist_offset + DGUS_FILE_COUNT < dgus_screen_handler.FileCount()) {
         icons |= (uint16_t)DGUS_Data::ScrollIcon::DOWN;
 
         dgus_display.EnableControl(DGUS_Screen::PRINT,
@@ -165,23 +155,19 @@
     }
 
     void DGUSTxHandler::SelectedFileName(DGUS_VP &vp) {
-      if (dgus_screen_handler.filelist_selected < 0
-          || !dgus_screen_handler.filelist.seek(dgus_screen_handler.filelist_selected)
-          ) {
+      if (dgus_screen_handler.filelist_selected < 0) {
         dgus_display.WriteStringPGM((uint16_t)vp.addr, NUL_STR, vp.size);
         return;
       }
 
-      const char *filename = dgus_screen_handler.filelist.filename();
+      const char *filename = dgus_screen_handler.file_selected.name;
       dgus_display.WriteString((uint16_t)vp.addr, filename, vp.size, true, false, false);
     }
 
     void DGUSTxHandler::SelectedFileNameFormat(DGUS_VP &vp) {
-      if (dgus_screen_handler.filelist_selected < 0
-          || !dgus_screen_handler.filelist.seek(dgus_screen_handler.filelist_selected)
-          )
+      if (dgus_screen_handler.filelist_selected < 0)
         return;
-      uint16_t txtlen = _MIN(strlen(dgus_screen_handler.filelist.filename()), DGUS_FILENAME_LEN);
+      uint16_t txtlen = _MIN(strlen(dgus_screen_handler.file_selected.name), DGUS_FILENAME_LEN);
       dgus_screen_handler.SetTextSize(vp.addr, txtlen, STATUS_Filename_Box, false);
     }
 
@@ -535,6 +521,13 @@
     dgus_display.WriteString((uint16_t)vp.addr, buffer, vp.size);
   }
 
+  void DGUSTxHandler::LinkSpeed(DGUS_VP &vp) {
+    char buffer[vp.size];
+    snprintf_P(buffer, vp.size, PSTR("%lu bd %u ms"), (unsigned long)dgus_display.GetBaudrate(), dgus_display.GetLinkRtt());
+
+    dgus_display.WriteString((uint16_t)vp.addr, buffer, vp.size);
+  }
+
   void DGUSTxHandler::TotalPrints(DGUS_VP &vp) {
     #if ENABLED(PRINTCOUNTER)
       dgus_display.Write((uint16_t)vp.addr, dgus_display.SwapBytes(print_job_timer.getStats().totalPrints));
@@ -620,6 +613,31 @@
     dgus_display.Write((uint16_t)vp.addr, Swap16(icons));
   }
 
+  void DGUSTxHandler::LatencyHistogram(DGUS_VP &vp) {
+    uint16_t data[DGUSDisplay::DGUS_LATENCY_BUCKETS];
+    LOOP_L_N(i, DGUSDisplay::DGUS_LATENCY_BUCKETS)
+      data[i] = Swap16(DGUSDisplay::stats.latency[i]);
+
+    dgus_display.Write((uint16_t)vp.addr, data, sizeof(data));
+  }
+
+  #if DGUS_ACK_WINDOW
+    void DGUSTxHandler::AckStats(DGUS_VP &vp) {
+      const uint16_t data[] = {
+        Swap16(dgus_display.GetAckRtt()),
+        Swap16(dgus_display.GetAckTimeouts())
+      };
+
+      dgus_display.Write((uint16_t)vp.addr, data, sizeof(data));
+    }
+  #endif
+
+  #if ENABLED(DGUS_CRC)
+    void DGUSTxHandler::CRCErrors(DGUS_VP &vp) {
+      dgus_display.Write((uint16_t)vp.addr, Swap16(dgus_display.GetCRCErrors()));
+    }
+  #endif
+
   void DGUSTxHandler::FanSpeed(DGUS_VP &vp) {
     uint16_t fan_speed;
 
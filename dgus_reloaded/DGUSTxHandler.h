@@ -64,6 +64,7 @@ namespace DGUSTxHandler {
   void PIDKd(DGUS_VP &);
 
   void BuildVolume(DGUS_VP &);
+  void LinkSpeed(DGUS_VP &);
   void TotalPrints(DGUS_VP &);
   void FinishedPrints(DGUS_VP &);
   void PrintTime(DGUS_VP &);
@@ -72,6 +73,14 @@ namespace DGUSTxHandler {
 
   void WaitIcons(DGUS_VP &);
 
+  void LatencyHistogram(DGUS_VP &);
+  #if DGUS_ACK_WINDOW
+    void AckStats(DGUS_VP &);
+  #endif
+  #if ENABLED(DGUS_CRC)
+    void CRCErrors(DGUS_VP &);
+  #endif
+
   void FanSpeed(DGUS_VP &);
 
   void Volume(DGUS_VP &);
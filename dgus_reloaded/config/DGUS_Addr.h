@@ -34,6 +34,8 @@ constexpr uint8_t DGUS_PRINTTIME_LEN    = 24;
 constexpr uint8_t DGUS_LONGESTPRINT_LEN = 24;
 constexpr uint8_t DGUS_FILAMENTUSED_LEN = 24;
 constexpr uint8_t DGUS_GCODE_LEN        = 32;
+constexpr uint8_t DGUS_LINK_LEN         = 16;
+constexpr uint8_t DGUS_FILTER_LEN       = 16;
 
 enum class DGUS_SP_Variable : uint8_t {
   X                  = 0x01,
@@ -136,6 +138,8 @@ enum class DGUS_Addr : uint16_t {
   FILAMENT_Load_Unload     = 0x2040, // GCTODO
   RUNOUT_Control           = 0x2041, // GCTODO
   STATUS_PrintPause        = 0x2042,
+  SD_Sort                  = 0x2043, // Data: DGUS_Data::FileSort
+  DEBUG_DumpStats          = 0x2044, // Print the link statistics to the serial port
 
   // WRITE-ONLY VARIABLES
 
@@ -202,6 +206,18 @@ enum class DGUS_Addr : uint16_t {
   MOVE_CurrentE            = 0x31C3, // Type: Fixed point, 1 decimal (16 bits signed)
   STATUS_Pause_Resume_Icon = 0x31C5, // 1 byte 0: resume, 1: pause
   LEVEL_AUTO_Grid          = 0x31C6, // 0x31C6 - 0x31DE / Type: Fixed point, 3 decimals (16 bits signed)
+  INFOS_Link               = 0x31DF, // 0x31DF - 0x31EE
+  DEBUG_TxBytes            = 0x31EF, // Type: Integer (16 bits unsigned) / Data: bytes per second
+  DEBUG_TxFrames           = 0x31F0, // Type: Integer (16 bits unsigned) / Data: frames per second
+  DEBUG_RxDatagrams        = 0x31F1, // Type: Integer (16 bits unsigned)
+  DEBUG_UnknownVP          = 0x31F2, // Type: Integer (16 bits unsigned)
+  DEBUG_SizeMismatch       = 0x31F3, // Type: Integer (16 bits unsigned)
+  DEBUG_Overruns           = 0x31F4, // Type: Integer (16 bits unsigned)
+  DEBUG_Latency            = 0x31F5, // 0x31F5 - 0x31FC / Type: Integer (16 bits unsigned) / Data: count per latency bucket
+  DEBUG_SaveRequests       = 0x31FD, // Type: Integer (16 bits unsigned)
+  DEBUG_Saves              = 0x31FE, // Type: Integer (16 bits unsigned)
+  DEBUG_Ack                = 0x31FF, // 0x31FF - 0x3200 / Type: Integer (16 bits unsigned) / Data: ACK round trip in ms, ACK timeouts
+  DEBUG_CRCErrors          = 0x3201, // Type: Integer (16 bits unsigned)
 
 
   // READ-WRITE VARIABLES
@@ -234,6 +250,7 @@ enum class DGUS_Addr : uint16_t {
   Min_Travel_Speed         = 0x4051, // int 3.1
   Z_Steps_mm               = 0x4053, // long 4.2
   E_Steps_mm               = 0x4057, // long 4.2
+  SD_Filter                = 0x4059, // 0x4059 - 0x4068 / Text the PRINT screen's file list is filtered by
 
 
   // SPECIAL CASES
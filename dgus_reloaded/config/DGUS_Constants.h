@@ -96,3 +96,142 @@ static_assert(LEVEL_CORNERS_Z_HOP >= 0, "LEVEL_CORNERS_Z_HOP must be >= 0. Pleas
     #define DGUS_RESET_BLTOUCH        "M999\nM280P0S160"
   #endif
 #endif
+
+#ifndef DGUS_TX_FRAME_SIZE
+  #ifdef __AVR__
+    #define DGUS_TX_FRAME_SIZE        64
+  #elif ENABLED(DGUS_CRC)
+    #define DGUS_TX_FRAME_SIZE        250
+  #else
+    #define DGUS_TX_FRAME_SIZE        252
+  #endif
+#endif
+static_assert(DGUS_TX_FRAME_SIZE + 3 + (ENABLED(DGUS_CRC) ? 2 : 0) <= 255, "DGUS_TX_FRAME_SIZE must fit in a single datagram (max 252, 250 with DGUS_CRC). Please update your configuration.");
+
+#ifndef DGUS_SHADOW_SIZE
+  #ifdef __AVR__
+    #define DGUS_SHADOW_SIZE          24 // Number of VPs whose last sent value is remembered (0 to disable)
+  #else
+    #define DGUS_SHADOW_SIZE          64
+  #endif
+#endif
+
+#ifndef DGUS_TEMP_DEADBAND
+  #define DGUS_TEMP_DEADBAND          1 // Current temperatures are only resent when changed by more than this (°C)
+#endif
+
+#ifndef DGUS_CONTROL_QUEUE_SIZE
+  #define DGUS_CONTROL_QUEUE_SIZE     16 // Touch controls whose enable state is tracked
+#endif
+
+#ifndef DGUS_CONTROL_INTERVAL_MS
+  #define DGUS_CONTROL_INTERVAL_MS    50 // Minimum time between two enable/disable commands
+#endif
+
+#ifndef DGUS_UPDATE_FAST_MS
+  #define DGUS_UPDATE_FAST_MS         250  // Refresh period of VPFLAG_RATE_FAST VPs (e.g. positions)
+#endif
+
+#ifndef DGUS_UPDATE_SLOW_MS
+  #define DGUS_UPDATE_SLOW_MS         5000 // Refresh period of VPFLAG_RATE_SLOW VPs (e.g. statistics)
+#endif
+
+#ifndef DGUS_UPDATE_BUDGET
+  #ifdef __AVR__
+    #define DGUS_UPDATE_BUDGET        96  // Bytes of screen data sent per Loop() call
+  #else
+    #define DGUS_UPDATE_BUDGET        256
+  #endif
+#endif
+
+#ifndef DGUS_RX_BUDGET
+  #define DGUS_RX_BUDGET              8 // Datagrams from the display handled per Loop() call (ACKs excluded)
+#endif
+
+#ifndef DGUS_RX_RING_SIZE
+  #ifdef __AVR__
+    #define DGUS_RX_RING_SIZE         128 // Bytes received from the display, parsed in place
+  #else
+    #define DGUS_RX_RING_SIZE         256
+  #endif
+#endif
+static_assert(DGUS_RX_RING_SIZE >= 16 && !(DGUS_RX_RING_SIZE & (DGUS_RX_RING_SIZE - 1)), "DGUS_RX_RING_SIZE must be a power of 2. Please update your configuration.");
+
+// Longest telegram accepted from the display
+#define DGUS_RX_TELEGRAM_SIZE         _MIN(DGUS_RX_BUFFER_SIZE, (DGUS_RX_RING_SIZE) / 2)
+
+#ifndef DGUS_ACK_WINDOW
+  #define DGUS_ACK_WINDOW             4   // Writes sent before waiting for the display's "OK" (0 to disable)
+#endif
+
+#ifndef DGUS_ACK_TIMEOUT_MS
+  #define DGUS_ACK_TIMEOUT_MS         100 // A write not acknowledged within this time is considered lost
+#endif
+
+#ifndef DGUS_BAUDRATES
+  // Tried in order on startup. Higher rates need a matching 22_config.bin in the display's DWIN_SET.
+  #ifdef __AVR__
+    #define DGUS_BAUDRATES            LCD_BAUDRATE // A 16 MHz UART is 3-8% off at 230400 and up
+  #else
+    #define DGUS_BAUDRATES            921600, 460800, LCD_BAUDRATE
+  #endif
+#endif
+
+#ifndef DGUS_BAUD_PROBE_MS
+  #define DGUS_BAUD_PROBE_MS          100  // Time to wait for the display to answer at one baudrate
+#endif
+
+#ifndef DGUS_BAUD_PROBE_TIMEOUT_MS
+  #define DGUS_BAUD_PROBE_TIMEOUT_MS  3000 // Keep probing this long while the display boots
+#endif
+
+#ifndef DGUS_READ_SLOTS
+  #define DGUS_READ_SLOTS             4   // Reads from the display that can wait for an answer at the same time
+#endif
+
+#ifndef DGUS_READ_TIMEOUT_MS
+  #define DGUS_READ_TIMEOUT_MS        500 // Reads not answered within this time fail
+#endif
+
+#ifndef DGUS_TX_QUEUE_SIZE
+  #ifdef __AVR__
+    #define DGUS_TX_QUEUE_SIZE        128 // Bytes of screen refresh frames held back behind interactive writes (0 to disable)
+  #else
+    #define DGUS_TX_QUEUE_SIZE        512
+  #endif
+#endif
+static_assert(!DGUS_TX_QUEUE_SIZE || DGUS_TX_QUEUE_SIZE >= DGUS_TX_FRAME_SIZE + 8, "DGUS_TX_QUEUE_SIZE must hold at least one frame. Please update your configuration.");
+
+#ifndef DGUS_HEARTBEAT_MS
+  #define DGUS_HEARTBEAT_MS           2000 // Interval of the page read that detects a display reset
+#endif
+
+#ifndef DGUS_HEARTBEAT_LOST
+  #define DGUS_HEARTBEAT_LOST         3    // Missed answers after which the display counts as disconnected
+#endif
+
+#ifndef DGUS_EEPROM_SAVE_DELAY_MS
+  #define DGUS_EEPROM_SAVE_DELAY_MS   5000 // Settings are saved once no change was made for this long and the printer is idle
+#endif
+
+#if ENABLED(SDSUPPORT)
+  // Files are listed in directory order unless DGUS_FILE_INDEX is enabled. It keeps a sorted index
+  // (DGUS_FILE_INDEX_NAME) in each directory browsed on the PRINT screen, so it writes to the card.
+  //#define DGUS_FILE_INDEX
+
+  #ifndef DGUS_FILE_INDEX_NAME
+    #define DGUS_FILE_INDEX_NAME      "DGUSIDX.DAT"
+  #endif
+
+  #ifndef DGUS_FILE_INDEX_MS
+    #define DGUS_FILE_INDEX_MS        10 // Time spent per Loop() call checking or building the index
+  #endif
+
+  #ifndef DGUS_FILE_INDEX_MAX
+    #define DGUS_FILE_INDEX_MAX       256 // Larger directories get no index. Building costs card I/O growing with the square of the entries.
+  #endif
+
+  #ifndef DGUS_FILE_SORT
+    #define DGUS_FILE_SORT            0  // 0: by name, 1: newest first (with DGUS_FILE_INDEX)
+  #endif
+#endif
@@ -33,6 +33,11 @@ namespace DGUS_Data {
     DOWN    = 2
   };
 
+  enum class FileSort : uint8_t {
+    NAME = 0,
+    DATE = 1
+  };
+
   enum class Popup : uint8_t {
     CONFIRMED = 1
   };
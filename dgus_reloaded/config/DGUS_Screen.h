@@ -57,3 +57,17 @@ enum class DGUS_Screen : uint8_t {
   WAIT                = 249,
   KILL                = 250
 };
+
+// Dense index of each screen, used to look up per-screen tables in O(1).
+constexpr uint8_t DGUS_SCREEN_COUNT = (uint8_t)DGUS_Screen::ADVANCED_SETTINGS_3 + 7;
+
+constexpr uint8_t DGUS_ScreenIndex(const DGUS_Screen screen) {
+  return (uint8_t)screen <= (uint8_t)DGUS_Screen::ADVANCED_SETTINGS_3 ? (uint8_t)screen
+       : screen == DGUS_Screen::PAUSE_CONFIRM  ? DGUS_SCREEN_COUNT - 6
+       : screen == DGUS_Screen::RESUME_CONFIRM ? DGUS_SCREEN_COUNT - 5
+       : screen == DGUS_Screen::DEBUG          ? DGUS_SCREEN_COUNT - 4
+       : screen == DGUS_Screen::POWERLOSS      ? DGUS_SCREEN_COUNT - 3
+       : screen == DGUS_Screen::WAIT           ? DGUS_SCREEN_COUNT - 2
+       : screen == DGUS_Screen::KILL           ? DGUS_SCREEN_COUNT - 1
+       : DGUS_SCREEN_COUNT; // Unknown screen
+}
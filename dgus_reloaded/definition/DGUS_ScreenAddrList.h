@@ -23,10 +23,17 @@
 
 #include "../config/DGUS_Screen.h"
 #include "../config/DGUS_Addr.h"
+#include "DGUS_VPList.h"
 
-struct DGUS_ScreenAddrList {
+struct DGUS_ScreenVPList {
   DGUS_Screen screen;
-  const DGUS_Addr   *addr_list;
+  const uint8_t *auto_list; // vp_list indices sent on every update
+  const uint8_t *full_list; // vp_list indices only sent on complete updates
 };
 
-extern const struct DGUS_ScreenAddrList screen_addr_list_map[];
+// Indexed by DGUS_ScreenIndex(). Screens without VPs have null lists.
+struct DGUS_ScreenVPMap {
+  DGUS_ScreenVPList screen[DGUS_SCREEN_COUNT];
+};
+
+extern const struct DGUS_ScreenVPMap screen_vp_map;
@@ -34,7 +34,7 @@
     { .screen   = SCREEN, \
       .setup_fn = SETUP }
 
-  const struct DGUS_ScreenSetup screen_setup_list[] PROGMEM = {
+  constexpr DGUS_ScreenSetup screen_setup_list[] = {
     #if ENABLED(SDSUPPORT)
       SETUP_HELPER(DGUS_Screen::PRINT,            &DGUSSetupHandler::Print),
     #endif
@@ -56,4 +56,21 @@
     SETUP_HELPER((DGUS_Screen)0, nullptr)
   };
 
+  constexpr DGUS_ScreenSetupMap DGUS_BuildScreenSetupMap() {
+    DGUS_ScreenSetupMap map = {};
+    for (const DGUS_ScreenSetup *setup = screen_setup_list; setup->setup_fn; setup++)
+      map.setup_fn[DGUS_ScreenIndex(setup->screen)] = setup->setup_fn;
+    return map;
+  }
+
+  constexpr bool DGUS_ValidScreenSetupList() {
+    for (const DGUS_ScreenSetup *setup = screen_setup_list; setup->setup_fn; setup++)
+      if (DGUS_ScreenIndex(setup->screen) >= DGUS_SCREEN_COUNT) return false;
+    return true;
+  }
+
+  static_assert(DGUS_ValidScreenSetupList(), "screen_setup_list contains an unknown DGUS_Screen.");
+
+  const struct DGUS_ScreenSetupMap screen_setup_map PROGMEM = DGUS_BuildScreenSetupMap();
+
 #endif // DGUS_LCD_UI_RELOADED
@@ -28,4 +28,9 @@ struct DGUS_ScreenSetup {
   bool (*setup_fn)(void);
 };
 
-extern const struct DGUS_ScreenSetup screen_setup_list[];
+// Indexed by DGUS_ScreenIndex(). Screens without setup have a null setup_fn.
+struct DGUS_ScreenSetupMap {
+  bool (*setup_fn[DGUS_SCREEN_COUNT])(void);
+};
+
+extern const struct DGUS_ScreenSetupMap screen_setup_map;
@@ -25,12 +25,29 @@
 
 #define VPFLAG_NONE         0
 #define VPFLAG_AUTOUPLOAD   (1U << 0) // Upload on every DGUS update
-#define VPFLAG_RXSTRING     (1U << 1) // Treat the received data as a string (terminated with 0xFFFF)
+#define VPFLAG_RXSTRING     (1U << 1) // Treat the received data as a string (terminated with 0xFFFF), size is its length on receive
+#define VPFLAG_RATE_FAST    (1U << 2) // Auto-upload every DGUS_UPDATE_FAST_MS instead of DGUS_UPDATE_INTERVAL_MS
+#define VPFLAG_RATE_SLOW    (1U << 3) // Auto-upload every DGUS_UPDATE_SLOW_MS instead of DGUS_UPDATE_INTERVAL_MS
+
+// Auto-upload classes, each refreshed on its own deadline
+enum DGUS_UpdateRate : uint8_t {
+  DGUS_RATE_NORMAL,
+  DGUS_RATE_FAST,
+  DGUS_RATE_SLOW,
+  DGUS_RATE_COUNT
+};
+
+constexpr DGUS_UpdateRate DGUS_VPRate(const uint8_t flags) {
+  return (flags & VPFLAG_RATE_FAST) ? DGUS_RATE_FAST
+       : (flags & VPFLAG_RATE_SLOW) ? DGUS_RATE_SLOW
+       : DGUS_RATE_NORMAL;
+}
 
 struct DGUS_VP {
   DGUS_Addr addr;
   uint8_t size;
   uint8_t flags;
+  uint8_t deadband; // Integer VPs: skip the upload while within +/- deadband of the last sent value
   void      *extra;
 
   // Callback that will be called if the display modified the value.
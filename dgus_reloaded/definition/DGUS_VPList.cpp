@@ -25,6 +25,7 @@
 #if ENABLED(DGUS_LCD_UI_RELOADED)
 
   #include "DGUS_VPList.h"
+  #include "DGUS_ScreenAddrList.h"
 
   #include "../config/DGUS_Addr.h"
   #include "../DGUSScreenHandler.h"
@@ -39,14 +40,18 @@
   const char DGUS_MACHINENAME[] PROGMEM = MACHINE_NAME;
   const char DGUS_MARLINVERSION[] PROGMEM = SHORT_BUILD_VERSION "-" __DATE__;
 
-  #define VP_HELPER(ADDR, SIZE, FLAGS, EXTRA, RXHANDLER, TXHANDLER) \
+  #define VP_HELPER_DEADBAND(ADDR, SIZE, FLAGS, DEADBAND, EXTRA, RXHANDLER, TXHANDLER) \
     { .addr       = ADDR, \
       .size       = SIZE, \
       .flags      = FLAGS, \
+      .deadband   = DEADBAND, \
       .extra      = EXTRA, \
       .rx_handler = RXHANDLER, \
       .tx_handler = TXHANDLER }
 
+  #define VP_HELPER(ADDR, SIZE, FLAGS, EXTRA, RXHANDLER, TXHANDLER) \
+    VP_HELPER_DEADBAND(ADDR, SIZE, FLAGS, 0, EXTRA, RXHANDLER, TXHANDLER)
+
   #define VP_HELPER_WORD(ADDR, FLAGS, EXTRA, RXHANDLER, TXHANDLER) \
     VP_HELPER(ADDR, 2, FLAGS, EXTRA, RXHANDLER, TXHANDLER)
 
@@ -71,6 +76,18 @@
   #define VP_HELPER_TX_AUTO(ADDR, EXTRA, TXHANDLER) \
     VP_HELPER_WORD(ADDR, VPFLAG_AUTOUPLOAD, EXTRA, nullptr, TXHANDLER)
 
+  #define VP_HELPER_TX_FAST(ADDR, EXTRA, TXHANDLER) \
+    VP_HELPER_WORD(ADDR, VPFLAG_AUTOUPLOAD | VPFLAG_RATE_FAST, EXTRA, nullptr, TXHANDLER)
+
+  #define VP_HELPER_TX_SLOW(ADDR, EXTRA, TXHANDLER) \
+    VP_HELPER_WORD(ADDR, VPFLAG_AUTOUPLOAD | VPFLAG_RATE_SLOW, EXTRA, nullptr, TXHANDLER)
+
+  #define VP_HELPER_TX_SLOW_SIZE(ADDR, SIZE, TXHANDLER) \
+    VP_HELPER(ADDR, SIZE, VPFLAG_AUTOUPLOAD | VPFLAG_RATE_SLOW, nullptr, nullptr, TXHANDLER)
+
+  #define VP_HELPER_TX_AUTO_DEADBAND(ADDR, DEADBAND, EXTRA, TXHANDLER) \
+    VP_HELPER_DEADBAND(ADDR, 2, VPFLAG_AUTOUPLOAD, DEADBAND, EXTRA, nullptr, TXHANDLER)
+
   #define RX(HANDLER)   & DGUSRxHandler::HANDLER
   #define TX(HANDLER)   & DGUSTxHandler::HANDLER
 
@@ -80,7 +97,7 @@
   #define VP_HELPER_TX_RX_SIZE(ADDR, SIZE, HANDLER) \
     VP_HELPER(ADDR, SIZE, VPFLAG_NONE, nullptr, RX(HANDLER), TX(HANDLER))
 
-  const struct DGUS_VP vp_list[] PROGMEM = {
+  constexpr struct DGUS_VP vp_list[] PROGMEM = {
 
     // READ-ONLY VARIABLES
 
@@ -93,6 +110,7 @@
       VP_HELPER_RX(DGUS_Addr::SD_SelectFile, &DGUSRxHandler::SelectFile),
       VP_HELPER_RX(DGUS_Addr::SD_Scroll, &DGUSRxHandler::Scroll),
       VP_HELPER_RX_NODATA(DGUS_Addr::SD_Print, &DGUSRxHandler::PrintFile),
+      VP_HELPER_RX(DGUS_Addr::SD_Sort, &DGUSRxHandler::SortFiles),
     #endif
 
     VP_HELPER_RX(DGUS_Addr::STATUS_Abort, &DGUSRxHandler::PrintAbort),
@@ -188,7 +206,7 @@
       VP_HELPER_TX(DGUS_Addr::SP_STATUS_Filename, &DGUSTxHandler::SelectedFileNameFormat),
     #endif
 
-    VP_HELPER_TX_AUTO(DGUS_Addr::STATUS_PositionZ,
+    VP_HELPER_TX_FAST(DGUS_Addr::STATUS_PositionZ,
       nullptr,
       &DGUSTxHandler::PositionZ),
     VP_HELPER(DGUS_Addr::STATUS_Ellapsed,
@@ -197,7 +215,7 @@
       nullptr,
       nullptr,
       &DGUSTxHandler::Ellapsed),
-    VP_HELPER_TX_AUTO(DGUS_Addr::STATUS_Percent,
+    VP_HELPER_TX_SLOW(DGUS_Addr::STATUS_Percent,
       nullptr,
       &DGUSTxHandler::Percent),
     //   VP_HELPER_TX(DGUS_Addr::STATUS_Icons, &DGUSTxHandler::StatusIcons),
@@ -217,14 +235,16 @@
       &DGUSTxHandler::Flowrate),
     #endif
 
-    VP_HELPER_TX_AUTO(DGUS_Addr::TEMP_Current_Bed,
+    VP_HELPER_TX_AUTO_DEADBAND(DGUS_Addr::TEMP_Current_Bed,
+      DGUS_TEMP_DEADBAND,
       &thermalManager.temp_bed.celsius,
       &DGUSTxHandler::ExtraToInteger<float>),
     VP_HELPER_TX_AUTO(DGUS_Addr::TEMP_Target_Bed,
       &thermalManager.temp_bed.target,
       &DGUSTxHandler::ExtraToInteger<int16_t>),
     VP_HELPER_TX(DGUS_Addr::TEMP_Max_Bed, &DGUSTxHandler::TempMax),
-    VP_HELPER_TX_AUTO(DGUS_Addr::TEMP_Current_H0,
+    VP_HELPER_TX_AUTO_DEADBAND(DGUS_Addr::TEMP_Current_H0,
+      DGUS_TEMP_DEADBAND,
       &thermalManager.temp_hotend[ExtUI::heater_t::H0].celsius,
       &DGUSTxHandler::ExtraToInteger<float>),
     VP_HELPER_TX_AUTO(DGUS_Addr::TEMP_Target_H0,
@@ -232,7 +252,8 @@
       &DGUSTxHandler::ExtraToInteger<int16_t>),
     VP_HELPER_TX(DGUS_Addr::TEMP_Max_H0, &DGUSTxHandler::TempMax),
     #if HOTENDS > 1
-      VP_HELPER_TX_AUTO(DGUS_Addr::TEMP_Current_H1,
+      VP_HELPER_TX_AUTO_DEADBAND(DGUS_Addr::TEMP_Current_H1,
+      DGUS_TEMP_DEADBAND,
       &thermalManager.temp_hotend[ExtUI::heater_t::H1].celsius,
       &DGUSTxHandler::ExtraToInteger<float>),
       VP_HELPER_TX_AUTO(DGUS_Addr::TEMP_Target_H1,
@@ -262,16 +283,16 @@
       &DGUSScreenHandler::filament_length,
       &DGUSTxHandler::ExtraToInteger<uint16_t>),
 
-    VP_HELPER_TX_AUTO(DGUS_Addr::MOVE_CurrentX,
+    VP_HELPER_TX_FAST(DGUS_Addr::MOVE_CurrentX,
       &current_position.x,
       (&DGUSTxHandler::ExtraToFixedPoint<float, 1>)),
-    VP_HELPER_TX_AUTO(DGUS_Addr::MOVE_CurrentY,
+    VP_HELPER_TX_FAST(DGUS_Addr::MOVE_CurrentY,
       &current_position.y,
       (&DGUSTxHandler::ExtraToFixedPoint<float, 1>)),
-    VP_HELPER_TX_AUTO(DGUS_Addr::MOVE_CurrentZ,
+    VP_HELPER_TX_FAST(DGUS_Addr::MOVE_CurrentZ,
       &current_position.z,
       (&DGUSTxHandler::ExtraToFixedPoint<float, 1>)),
-    VP_HELPER_TX_AUTO(DGUS_Addr::MOVE_CurrentE,
+    VP_HELPER_TX_FAST(DGUS_Addr::MOVE_CurrentE,
       &current_position.e,
       (&DGUSTxHandler::ExtraToFixedPoint<float, 1>)),
     VP_HELPER_TX_EXTRA(DGUS_Addr::MOVE_StepIcons,
@@ -285,17 +306,17 @@
       &DGUSScreenHandler::pid_temp,
       &DGUSTxHandler::ExtraToInteger<uint16_t>),
     VP_HELPER_DWORD(DGUS_Addr::PID_Kp,
-      VPFLAG_AUTOUPLOAD,
+      VPFLAG_AUTOUPLOAD | VPFLAG_RATE_SLOW,
       nullptr,
       nullptr,
       &DGUSTxHandler::PIDKp),
     VP_HELPER_DWORD(DGUS_Addr::PID_Ki,
-      VPFLAG_AUTOUPLOAD,
+      VPFLAG_AUTOUPLOAD | VPFLAG_RATE_SLOW,
       nullptr,
       nullptr,
       &DGUSTxHandler::PIDKi),
     VP_HELPER_DWORD(DGUS_Addr::PID_Kd,
-      VPFLAG_AUTOUPLOAD,
+      VPFLAG_AUTOUPLOAD | VPFLAG_RATE_SLOW,
       nullptr,
       nullptr,
       &DGUSTxHandler::PIDKd),
@@ -315,19 +336,64 @@
       (void *)DGUS_MARLINVERSION,
       nullptr,
       &DGUSTxHandler::ExtraPGMToString),
-    VP_HELPER_TX(DGUS_Addr::INFOS_TotalPrints, &DGUSTxHandler::TotalPrints),
-    VP_HELPER_TX(DGUS_Addr::INFOS_FinishedPrints, &DGUSTxHandler::FinishedPrints),
-    VP_HELPER_TX_SIZE(DGUS_Addr::INFOS_PrintTime,
+    VP_HELPER_TX_SIZE(DGUS_Addr::INFOS_Link,
+      DGUS_LINK_LEN,
+      &DGUSTxHandler::LinkSpeed),
+    VP_HELPER_TX_SLOW(DGUS_Addr::INFOS_TotalPrints, nullptr, &DGUSTxHandler::TotalPrints),
+    VP_HELPER_TX_SLOW(DGUS_Addr::INFOS_FinishedPrints, nullptr, &DGUSTxHandler::FinishedPrints),
+    VP_HELPER_TX_SLOW_SIZE(DGUS_Addr::INFOS_PrintTime,
       DGUS_PRINTTIME_LEN,
       &DGUSTxHandler::PrintTime),
-    VP_HELPER_TX_SIZE(DGUS_Addr::INFOS_LongestPrint,
+    VP_HELPER_TX_SLOW_SIZE(DGUS_Addr::INFOS_LongestPrint,
       DGUS_LONGESTPRINT_LEN,
       &DGUSTxHandler::LongestPrint),
-    VP_HELPER_TX_SIZE(DGUS_Addr::INFOS_FilamentUsed,
+    VP_HELPER_TX_SLOW_SIZE(DGUS_Addr::INFOS_FilamentUsed,
       DGUS_FILAMENTUSED_LEN,
       &DGUSTxHandler::FilamentUsed),
 
     VP_HELPER_TX(DGUS_Addr::WAIT_Icons, &DGUSTxHandler::WaitIcons),
+
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_TxBytes,
+      &DGUSDisplay::stats.tx_bytes_ps,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_TxFrames,
+      &DGUSDisplay::stats.tx_frames_ps,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_RxDatagrams,
+      &DGUSDisplay::stats.rx_datagrams,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_UnknownVP,
+      &DGUSDisplay::stats.unknown_vp,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_SizeMismatch,
+      &DGUSDisplay::stats.size_mismatch,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_Overruns,
+      &DGUSDisplay::stats.overruns,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    VP_HELPER(DGUS_Addr::DEBUG_Latency,
+      DGUSDisplay::DGUS_LATENCY_BUCKETS * 2,
+      VPFLAG_AUTOUPLOAD,
+      nullptr,
+      nullptr,
+      &DGUSTxHandler::LatencyHistogram),
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_SaveRequests,
+      &DGUSScreenHandler::save_requests,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_Saves,
+      &DGUSScreenHandler::saves,
+      &DGUSTxHandler::ExtraToInteger<uint16_t>),
+    #if DGUS_ACK_WINDOW
+      VP_HELPER(DGUS_Addr::DEBUG_Ack,
+        2 * 2,
+        VPFLAG_AUTOUPLOAD,
+        nullptr,
+        nullptr,
+        &DGUSTxHandler::AckStats),
+    #endif
+    #if ENABLED(DGUS_CRC)
+      VP_HELPER_TX_AUTO(DGUS_Addr::DEBUG_CRCErrors, nullptr, &DGUSTxHandler::CRCErrors),
+    #endif
     VP_HELPER_TX_AUTO(DGUS_Addr::FAN0_Speed_CUR, nullptr, &DGUSTxHandler::FanSpeed),
     VP_HELPER_TX_AUTO(DGUS_Addr::STATUS_Feedrate_MMS, nullptr, &DGUSTxHandler::FeedrateMMS),
     VP_HELPER_TX_AUTO(DGUS_Addr::STATUS_Pause_Resume_Icon, nullptr, &DGUSTxHandler::StatusIcons),
@@ -349,6 +415,15 @@
       &DGUSRxHandler::StringToExtra,
       &DGUSTxHandler::ExtraToString),
 
+    #if ENABLED(SDSUPPORT)
+      VP_HELPER(DGUS_Addr::SD_Filter,
+        DGUS_FILTER_LEN,
+        VPFLAG_RXSTRING,
+        (void *)DGUSScreenHandler::file_filter,
+        &DGUSRxHandler::FileFilter,
+        &DGUSTxHandler::ExtraToString),
+    #endif
+
     VP_HELPER(DGUS_Addr::PID_Cycles,
       2,
       VPFLAG_NONE,
@@ -398,9 +473,456 @@
 
     VP_HELPER_TX(DGUS_Addr::STATUS_Percent_Complete, &DGUSTxHandler::Percent),
     VP_HELPER_RX_NODATA(DGUS_Addr::INFOS_Debug, &DGUSRxHandler::Debug),
+    VP_HELPER_RX_NODATA(DGUS_Addr::DEBUG_DumpStats, &DGUSRxHandler::DumpStats),
 
     VP_HELPER((DGUS_Addr)0, 0, VPFLAG_NONE, nullptr, nullptr, nullptr)
 
   };
 
+  // Indices into vp_list, ordered by address. Built at compile time so lookups are a binary search.
+
+  constexpr size_t vp_count = COUNT(vp_list) - 1; // Without the terminator
+
+  static_assert(vp_count < 0xFF, "vp_list is too long for an 8-bit index.");
+
+  struct DGUS_VPIndex {
+    uint8_t idx[vp_count];
+  };
+
+  constexpr DGUS_VPIndex DGUS_SortVPs() {
+    DGUS_VPIndex index = {};
+    for (size_t i = 0; i < vp_count; i++) {
+      size_t j = i;
+      for (; j > 0 && (uint16_t)vp_list[index.idx[j - 1]].addr > (uint16_t)vp_list[i].addr; j--)
+        index.idx[j] = index.idx[j - 1];
+      index.idx[j] = i;
+    }
+    return index;
+  }
+
+  constexpr DGUS_VPIndex vp_index PROGMEM = DGUS_SortVPs();
+
+  constexpr bool DGUS_UniqueVPs() {
+    for (size_t i = 1; i < vp_count; i++)
+      if (vp_list[vp_index.idx[i]].addr == vp_list[vp_index.idx[i - 1]].addr) return false;
+    return true;
+  }
+
+  static_assert(DGUS_UniqueVPs(), "vp_list contains the same DGUS_Addr more than once.");
+
+  uint8_t DGUS_FindVP(const DGUS_Addr addr) {
+    uint8_t lo = 0, hi = vp_count;
+
+    while (lo < hi) {
+      const uint8_t mid        = lo + (hi - lo) / 2;
+      const uint8_t index      = pgm_read_byte(&vp_index.idx[mid]);
+      const uint16_t addrcheck = pgm_read_word(&vp_list[index].addr);
+
+      if (addrcheck == (uint16_t)addr)
+        return index;
+
+      if (addrcheck < (uint16_t)addr)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+    return DGUS_VP_NONE;
+  }
+
+  bool DGUS_PopulateVP(const DGUS_Addr addr, DGUS_VP *const buffer) {
+    const uint8_t index = DGUS_FindVP(addr);
+
+    if (index == DGUS_VP_NONE) {
+      DEBUG_ECHOLNPAIR_F("VP not found: ", (uint16_t)addr);
+      return false;
+    }
+
+    memcpy_P(buffer, &vp_list[index], sizeof(*buffer));
+    return true;
+  }
+
+  // Screen VP lists. Only used at compile time, see RESOLVE_SCREEN_VPS below.
+
+  constexpr DGUS_Addr LIST_HOME[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Current_Bed,
+    DGUS_Addr::TEMP_Target_Bed,
+    (DGUS_Addr)0
+  };
+
+  #if ENABLED(SDSUPPORT)
+    constexpr DGUS_Addr LIST_PRINT[] PROGMEM = {
+      DGUS_Addr::SD_Type,
+      DGUS_Addr::SD_FileName0,
+      DGUS_Addr::SD_FileName1,
+      DGUS_Addr::SD_FileName2,
+      DGUS_Addr::SD_FileName3,
+      DGUS_Addr::SD_FileName4,
+      DGUS_Addr::SD_ScrollIcons,
+      DGUS_Addr::SD_SelectedFileName,
+      DGUS_Addr::SD_Filter,
+      (DGUS_Addr)0
+    };
+  #endif
+
+  constexpr DGUS_Addr LIST_PRINT_STATUS[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Current_Bed,
+    DGUS_Addr::TEMP_Target_Bed,
+    DGUS_Addr::STATUS_PositionZ,
+    DGUS_Addr::STATUS_Ellapsed,
+    DGUS_Addr::STATUS_Percent,
+//  DGUS_Addr::STATUS_Icons,
+    DGUS_Addr::SD_SelectedFileName,
+    DGUS_Addr::SP_STATUS_Filename,
+    DGUS_Addr::FAN0_Speed_CUR,
+    DGUS_Addr::STATUS_Feedrate_MMS,
+    DGUS_Addr::STATUS_Pause_Resume_Icon,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_PRINT_ADJUST[] PROGMEM = {
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Target_Bed,
+    DGUS_Addr::FAN0_Speed,
+    DGUS_Addr::ADJUST_Feedrate,
+    DGUS_Addr::ADJUST_Flowrate_CUR,
+    DGUS_Addr::LEVEL_OFFSET_Current,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_PRINT_FINISHED[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Current_Bed,
+    DGUS_Addr::TEMP_Target_Bed,
+    DGUS_Addr::STATUS_PositionZ,
+    DGUS_Addr::STATUS_Ellapsed,
+    DGUS_Addr::STATUS_Percent_Complete,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_TEMP_MENU[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Current_Bed,
+    DGUS_Addr::TEMP_Target_Bed,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_TEMP_MANUAL[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Max_H0,
+    DGUS_Addr::TEMP_Current_Bed,
+    DGUS_Addr::TEMP_Target_Bed,
+    DGUS_Addr::TEMP_Max_Bed,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_FAN[] PROGMEM = {
+    DGUS_Addr::FAN0_Speed,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_SETTINGS_MENU[] PROGMEM = {
+    // DGUS_Addr::STEPPER_Status,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_LEVELING_OFFSET[] PROGMEM = {
+    DGUS_Addr::LEVEL_OFFSET_Current,
+    DGUS_Addr::LEVEL_OFFSET_StepIcons,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_LEVELING_MANUAL[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Current_Bed,
+    DGUS_Addr::TEMP_Target_Bed,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_LEVELING_AUTOMATIC[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::TEMP_Current_Bed,
+    DGUS_Addr::TEMP_Target_Bed,
+//  DGUS_Addr::LEVEL_AUTO_DisableIcon,
+    DGUS_Addr::LEVEL_AUTO_Grid,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_LEVELING_PROBING[] PROGMEM = {
+    // DGUS_Addr::LEVEL_PROBING_Icons1,
+    // DGUS_Addr::LEVEL_PROBING_Icons2,
+    DGUS_Addr::SP_LEVEL_AUTO_Grid,
+    DGUS_Addr::LEVEL_AUTO_Grid,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_FILAMENT[] PROGMEM = {
+    DGUS_Addr::TEMP_Current_H0,
+    DGUS_Addr::TEMP_Target_H0,
+    DGUS_Addr::FILAMENT_ExtruderIcons,
+    DGUS_Addr::FILAMENT_Length,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_MOVE[] PROGMEM = {
+    DGUS_Addr::MOVE_CurrentX,
+    DGUS_Addr::MOVE_CurrentY,
+    DGUS_Addr::MOVE_CurrentZ,
+    DGUS_Addr::MOVE_CurrentE,
+    DGUS_Addr::MOVE_StepIcons,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_GCODE[] PROGMEM = {
+    DGUS_Addr::GCODE_Data,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_SETTINGS_MENU2[] PROGMEM = {
+    // DGUS_Addr::SETTINGS2_BLTouch,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_PID[] PROGMEM = {
+    DGUS_Addr::PID_HeaterIcons,
+    DGUS_Addr::PID_Temp,
+    DGUS_Addr::PID_Cycles,
+    DGUS_Addr::PID_Kp,
+    DGUS_Addr::PID_Ki,
+    DGUS_Addr::PID_Kd,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_VOLUME[] PROGMEM = {
+    DGUS_Addr::VOLUME_Level,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_BRIGHTNESS[] PROGMEM = {
+    DGUS_Addr::BRIGHTNESS_Level,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_SCREEN_SETTINGS[] PROGMEM = {
+    DGUS_Addr::BRIGHTNESS_Level,
+    DGUS_Addr::VOLUME_Level,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_INFOS[] PROGMEM = {
+    DGUS_Addr::INFOS_Machine,
+    DGUS_Addr::INFOS_BuildVolume,
+    DGUS_Addr::INFOS_Version,
+    DGUS_Addr::INFOS_Link,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_STATS[] PROGMEM = {
+    DGUS_Addr::INFOS_TotalPrints,
+    DGUS_Addr::INFOS_FinishedPrints,
+    DGUS_Addr::INFOS_PrintTime,
+    DGUS_Addr::INFOS_LongestPrint,
+    DGUS_Addr::INFOS_FilamentUsed,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_DEBUG[] PROGMEM = {
+    DGUS_Addr::DEBUG_TxBytes,
+    DGUS_Addr::DEBUG_TxFrames,
+    DGUS_Addr::DEBUG_RxDatagrams,
+    DGUS_Addr::DEBUG_UnknownVP,
+    DGUS_Addr::DEBUG_SizeMismatch,
+    DGUS_Addr::DEBUG_Overruns,
+    DGUS_Addr::DEBUG_Latency,
+    DGUS_Addr::DEBUG_SaveRequests,
+    DGUS_Addr::DEBUG_Saves,
+    #if DGUS_ACK_WINDOW
+      DGUS_Addr::DEBUG_Ack,
+    #endif
+    #if ENABLED(DGUS_CRC)
+      DGUS_Addr::DEBUG_CRCErrors,
+    #endif
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_WAIT[] PROGMEM = {
+    DGUS_Addr::WAIT_Icons,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_ADVANCED_SETTINGS_1[] PROGMEM = {
+    DGUS_Addr::X_Steps_mm,
+    DGUS_Addr::Y_Steps_mm,
+    DGUS_Addr::Z_Steps_mm,
+    DGUS_Addr::E_Steps_mm,
+    DGUS_Addr::X_Jerk_Steps_mm,
+    DGUS_Addr::Y_Jerk_Steps_mm,
+    DGUS_Addr::Z_Jerk_Steps_mm,
+    DGUS_Addr::E_Jerk_Steps_mm,
+    DGUS_Addr::JunctionDeviation,
+    DGUS_Addr::Linear_Advance,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_ADVANCED_SETTINGS_2[] PROGMEM = {
+    DGUS_Addr::X_Acceleration,
+    DGUS_Addr::Y_Acceleration,
+    DGUS_Addr::Z_Acceleration,
+    DGUS_Addr::E_Acceleration,
+    DGUS_Addr::Print_Acceleration,
+    DGUS_Addr::Retract_Acceleration,
+    DGUS_Addr::Travel_Acceleration,
+    (DGUS_Addr)0
+  };
+
+  constexpr DGUS_Addr LIST_ADVANCED_SETTINGS_3[] PROGMEM = {
+    DGUS_Addr::X_Max_Speed,
+    DGUS_Addr::Y_Max_Speed,
+    DGUS_Addr::Z_Max_Speed,
+    DGUS_Addr::E_Max_Speed,
+    DGUS_Addr::Min_Speed,
+    DGUS_Addr::Min_Travel_Speed,
+    (DGUS_Addr)0
+  };
+
+  // Resolve every screen list against vp_list at compile time. Only VPs that have a
+  // tx_handler are kept, split by whether they are sent on every update or only on
+  // complete updates. Each list holds indices into vp_list, terminated by DGUS_VP_NONE.
+
+  constexpr uint8_t DGUS_FindVPIndex(const DGUS_Addr addr) {
+    for (size_t i = 0; i < vp_count; i++)
+      if (vp_list[i].addr == addr) return i;
+    return DGUS_VP_NONE;
+  }
+
+  constexpr bool DGUS_KeepVP(const DGUS_Addr addr, const bool autoupload) {
+    const uint8_t i = DGUS_FindVPIndex(addr);
+    return i != DGUS_VP_NONE
+        && vp_list[i].tx_handler
+        && !!(vp_list[i].flags & VPFLAG_AUTOUPLOAD) == autoupload;
+  }
+
+  constexpr size_t DGUS_CountVPs(const DGUS_Addr *list, const bool autoupload) {
+    size_t n = 0;
+    for (; *list != (DGUS_Addr)0; list++)
+      if (DGUS_KeepVP(*list, autoupload)) n++;
+    return n;
+  }
+
+  template<size_t N>
+  struct DGUS_VPIndexList {
+    uint8_t idx[N + 1];
+  };
+
+  template<size_t N>
+  constexpr DGUS_VPIndexList<N> DGUS_ResolveVPs(const DGUS_Addr *list, const bool autoupload) {
+    DGUS_VPIndexList<N> resolved = {};
+    size_t n = 0;
+    for (; *list != (DGUS_Addr)0; list++)
+      if (DGUS_KeepVP(*list, autoupload)) resolved.idx[n++] = DGUS_FindVPIndex(*list);
+    resolved.idx[n] = DGUS_VP_NONE;
+    return resolved;
+  }
+
+  #define RESOLVE_SCREEN_VPS(LIST) \
+    constexpr auto LIST##_AUTO PROGMEM = DGUS_ResolveVPs<DGUS_CountVPs(LIST, true)>(LIST, true); \
+    constexpr auto LIST##_FULL PROGMEM = DGUS_ResolveVPs<DGUS_CountVPs(LIST, false)>(LIST, false)
+
+  RESOLVE_SCREEN_VPS(LIST_HOME);
+  #if ENABLED(SDSUPPORT)
+    RESOLVE_SCREEN_VPS(LIST_PRINT);
+  #endif
+  RESOLVE_SCREEN_VPS(LIST_PRINT_STATUS);
+  RESOLVE_SCREEN_VPS(LIST_PRINT_ADJUST);
+  RESOLVE_SCREEN_VPS(LIST_PRINT_FINISHED);
+  RESOLVE_SCREEN_VPS(LIST_TEMP_MENU);
+  RESOLVE_SCREEN_VPS(LIST_TEMP_MANUAL);
+  RESOLVE_SCREEN_VPS(LIST_FAN);
+  RESOLVE_SCREEN_VPS(LIST_SETTINGS_MENU);
+  RESOLVE_SCREEN_VPS(LIST_LEVELING_OFFSET);
+  RESOLVE_SCREEN_VPS(LIST_LEVELING_MANUAL);
+  RESOLVE_SCREEN_VPS(LIST_LEVELING_AUTOMATIC);
+  RESOLVE_SCREEN_VPS(LIST_LEVELING_PROBING);
+  RESOLVE_SCREEN_VPS(LIST_FILAMENT);
+  RESOLVE_SCREEN_VPS(LIST_MOVE);
+  RESOLVE_SCREEN_VPS(LIST_GCODE);
+  RESOLVE_SCREEN_VPS(LIST_SETTINGS_MENU2);
+  RESOLVE_SCREEN_VPS(LIST_PID);
+  RESOLVE_SCREEN_VPS(LIST_VOLUME);
+  RESOLVE_SCREEN_VPS(LIST_BRIGHTNESS);
+  RESOLVE_SCREEN_VPS(LIST_SCREEN_SETTINGS);
+  RESOLVE_SCREEN_VPS(LIST_INFOS);
+  RESOLVE_SCREEN_VPS(LIST_STATS);
+  RESOLVE_SCREEN_VPS(LIST_DEBUG);
+  RESOLVE_SCREEN_VPS(LIST_WAIT);
+  RESOLVE_SCREEN_VPS(LIST_ADVANCED_SETTINGS_1);
+  RESOLVE_SCREEN_VPS(LIST_ADVANCED_SETTINGS_2);
+  RESOLVE_SCREEN_VPS(LIST_ADVANCED_SETTINGS_3);
+
+  #define MAP_HELPER(SCREEN, LIST) \
+    { .screen    = SCREEN, \
+      .auto_list = LIST##_AUTO.idx, \
+      .full_list = LIST##_FULL.idx }
+
+  constexpr DGUS_ScreenVPList screen_vp_list[] = {
+    MAP_HELPER(DGUS_Screen::HOME,                 LIST_HOME),
+    #if ENABLED(SDSUPPORT)
+      MAP_HELPER(DGUS_Screen::PRINT,              LIST_PRINT),
+    #endif
+    MAP_HELPER(DGUS_Screen::PRINT_STATUS,         LIST_PRINT_STATUS),
+    MAP_HELPER(DGUS_Screen::PRINT_ADJUST,         LIST_PRINT_ADJUST),
+    MAP_HELPER(DGUS_Screen::PRINT_FINISHED,       LIST_PRINT_FINISHED),
+    MAP_HELPER(DGUS_Screen::TEMP_MENU,            LIST_TEMP_MENU),
+    MAP_HELPER(DGUS_Screen::TEMP_MANUAL,          LIST_TEMP_MANUAL),
+    MAP_HELPER(DGUS_Screen::FAN,                  LIST_FAN),
+    MAP_HELPER(DGUS_Screen::SETTINGS_MENU,        LIST_SETTINGS_MENU),
+    MAP_HELPER(DGUS_Screen::LEVELING_OFFSET,      LIST_LEVELING_OFFSET),
+    MAP_HELPER(DGUS_Screen::LEVELING_MANUAL,      LIST_LEVELING_MANUAL),
+    MAP_HELPER(DGUS_Screen::LEVELING_AUTOMATIC,   LIST_LEVELING_AUTOMATIC),
+    MAP_HELPER(DGUS_Screen::LEVELING_PROBING,     LIST_LEVELING_PROBING),
+    MAP_HELPER(DGUS_Screen::FILAMENT,             LIST_FILAMENT),
+    MAP_HELPER(DGUS_Screen::MOVE,                 LIST_MOVE),
+    MAP_HELPER(DGUS_Screen::GCODE,                LIST_GCODE),
+    MAP_HELPER(DGUS_Screen::SETTINGS_MENU2,       LIST_SETTINGS_MENU2),
+    MAP_HELPER(DGUS_Screen::PID,                  LIST_PID),
+    MAP_HELPER(DGUS_Screen::VOLUME,               LIST_VOLUME),
+    MAP_HELPER(DGUS_Screen::BRIGHTNESS,           LIST_BRIGHTNESS),
+    MAP_HELPER(DGUS_Screen::INFOS,                LIST_INFOS),
+    MAP_HELPER(DGUS_Screen::STATS,                LIST_STATS),
+    MAP_HELPER(DGUS_Screen::SCREEN_SETTINGS,      LIST_SCREEN_SETTINGS),
+    MAP_HELPER(DGUS_Screen::ADVANCED_SETTINGS_1,  LIST_ADVANCED_SETTINGS_1),
+    MAP_HELPER(DGUS_Screen::ADVANCED_SETTINGS_2,  LIST_ADVANCED_SETTINGS_2),
+    MAP_HELPER(DGUS_Screen::ADVANCED_SETTINGS_3,  LIST_ADVANCED_SETTINGS_3),
+    MAP_HELPER(DGUS_Screen::DEBUG,                LIST_DEBUG),
+    MAP_HELPER(DGUS_Screen::WAIT,                 LIST_WAIT),
+
+    { .screen = (DGUS_Screen)0, .auto_list = nullptr, .full_list = nullptr }
+  };
+
+  constexpr DGUS_ScreenVPMap DGUS_BuildScreenVPMap() {
+    DGUS_ScreenVPMap map = {};
+    for (const DGUS_ScreenVPList *list = screen_vp_list; list->auto_list; list++)
+      map.screen[DGUS_ScreenIndex(list->screen)] = *list;
+    return map;
+  }
+
+  constexpr bool DGUS_ValidScreenVPList() {
+    for (const DGUS_ScreenVPList *list = screen_vp_list; list->auto_list; list++)
+      if (DGUS_ScreenIndex(list->screen) >= DGUS_SCREEN_COUNT) return false;
+    return true;
+  }
+
+  static_assert(DGUS_ValidScreenVPList(), "screen_vp_list contains an unknown DGUS_Screen.");
+
+  const struct DGUS_ScreenVPMap screen_vp_map PROGMEM = DGUS_BuildScreenVPMap();
+
 #endif // DGUS_LCD_UI_RELOADED
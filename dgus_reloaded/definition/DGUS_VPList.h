@@ -24,3 +24,9 @@
 #include "DGUS_VP.h"
 
 extern const struct DGUS_VP vp_list[];
+
+// Invalid vp_list index, also terminates the VP index lists
+constexpr uint8_t DGUS_VP_NONE = 0xFF;
+
+/// Index of the VP for addr in vp_list, DGUS_VP_NONE if not found.
+extern uint8_t DGUS_FindVP(const DGUS_Addr addr);
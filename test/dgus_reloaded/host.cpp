@@ -0,0 +1,117 @@
+/**
+  * Marlin 3D Printer Firmware
+  * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+  *
+  * Based on Sprinter and grbl.
+  * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  *
+  */
+
+/**
+ * Host implementations of what the tests run through: the display's serial port, the clock
+ * and the Marlin functions the code under test calls.
+ */
+
+#include "inc/MarlinConfigPre.h"
+
+#include "DGUSDisplay.h"
+#include "DGUSScreenHandler.h"
+
+DGUSDisplay dgus_display;
+DGUSScreenHandler dgus_screen_handler;
+
+HostSerial LCD_SERIAL;
+GcodeSuite gcode;
+
+namespace Host {
+
+  millis_t now = 0;
+
+  static uint8_t rx[1024];
+  static size_t rx_len, rx_pos;
+
+  uint8_t sent[1024];
+  size_t sent_len;
+
+  void Receive(const uint8_t *data, size_t len) {
+    if (rx_pos == rx_len) rx_pos = rx_len = 0;
+    memcpy(&rx[rx_len], data, len);
+    rx_len += len;
+  }
+
+  void ClearSent() {
+    sent_len = 0;
+  }
+
+}
+
+void HostSerial::begin(long) {}
+void HostSerial::end() {}
+
+size_t HostSerial::write(uint8_t value) {
+  return write(&value, 1);
+}
+
+size_t HostSerial::write(const uint8_t *data, size_t len) {
+  const size_t room = sizeof(Host::sent) - Host::sent_len,
+               count = len < room ? len : room;
+  memcpy(&Host::sent[Host::sent_len], data, count);
+  Host::sent_len += count;
+  return len;
+}
+
+int HostSerial::read() {
+  return Host::rx_pos < Host::rx_len ? Host::rx[Host::rx_pos++] : -1;
+}
+
+int HostSerial::peek() {
+  return Host::rx_pos < Host::rx_len ? Host::rx[Host::rx_pos] : -1;
+}
+
+int HostSerial::available() {
+  return Host::rx_len - Host::rx_pos;
+}
+
+int HostSerial::availableForWrite() {
+  return 64;
+}
+
+void HostSerial::flush() {
+  Host::rx_pos = Host::rx_len = 0;
+}
+
+void HostSerial::flushTX() {}
+
+bool HostSerial::buffer_overruns() {
+  return false;
+}
+
+uint32_t millis() { return Host::now; }
+uint32_t micros() { return Host::now * 1000; }
+void delay(uint32_t ms) { Host::now += ms; }
+void idle() {}
+
+millis_t ExtUI::safe_millis() { return Host::now; }
+
+void GcodeSuite::reset_stepper_timeout() {}
+
+bool printingIsActive() { return false; }
+bool printingIsPaused() { return false; }
+
+static bool leveling_active = false;
+bool ExtUI::getLevelingActive() { return leveling_active; }
+void ExtUI::setLevelingActive(const bool state) { leveling_active = state; }
+bool ExtUI::getMeshValid() { return true; }
@@ -0,0 +1,313 @@
+/**
+  * Marlin 3D Printer Firmware
+  * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+  *
+  * Based on Sprinter and grbl.
+  * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  *
+  */
+
+/**
+ * Stand-ins for the Marlin headers that dgus_reloaded includes, just enough to build it on the
+ * host for the tests in this directory. The Makefile points every included Marlin header here.
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+
+#define _ISENA_1    ~,1
+#define _SECOND(a,b,...) b
+#define _PROBE(...) _SECOND(__VA_ARGS__,0,)
+#define _CAT(a,b) a##b
+#define CAT(a,b) _CAT(a,b)
+#define ENABLED(V) _PROBE(CAT(_ISENA_,V))
+#define DISABLED(V) (!ENABLED(V))
+#define ANY(a,b) (ENABLED(a)||ENABLED(b))
+#define EITHER(a,b) ANY(a,b)
+#define BOTH(a,b) (ENABLED(a)&&ENABLED(b))
+#define _TERN_1(A) A
+#define _TERN_0(A)
+#define TERN_(O,A) CAT(_TERN_,ENABLED(O))(A)
+#define TERN(O,A,B) ((ENABLED(O))?(A):(B))
+#define TERN0(O,A) ((ENABLED(O))?(A):0)
+#define PIN_EXISTS(P) 0
+
+#define DGUS_LCD_UI_RELOADED 1
+#define SDSUPPORT 1
+#define AUTO_BED_LEVELING_BILINEAR 1
+#define HAS_LEVELING 1
+#define HAS_MESH 1
+#define HAS_PID_HEATING 1
+#define PIDTEMP 1
+#define PRINTCOUNTER 1
+#define POWER_LOSS_RECOVERY 1
+#define ADVANCED_PAUSE_FEATURE 1
+#define HAS_JUNCTION_DEVIATION 1
+#define LIN_ADVANCE 1
+#define EXTRUDERS 1
+#define HOTENDS 1
+#define GRID_MAX_POINTS_X 5
+#define GRID_MAX_POINTS_Y 5
+#define LEVEL_CORNERS_INSET_LFRB { 30, 30, 30, 30 }
+#define X_BED_SIZE 220
+#define Y_BED_SIZE 220
+#define X_MIN_POS 0
+#define Y_MIN_POS 0
+#define Z_MIN_POS 0
+#define X_MAX_POS 220
+#define Y_MAX_POS 220
+#define Z_MAX_POS 250
+#define HEATER_0_MAXTEMP 275
+#define HEATER_0_MINTEMP 5
+#define HOTEND_OVERSHOOT 15
+#define BED_MAX_TARGET 110
+#define BED_MINTEMP 5
+#define EXTRUDE_MAXLENGTH 200
+#define EXTRUDE_MINTEMP 170
+#define MACHINE_NAME "LK4 Pro"
+#define SHORT_BUILD_VERSION "2.0.9"
+#define LCD_LANGUAGE en
+#define LCD_BAUDRATE 115200
+#define DGUS_RX_BUFFER_SIZE 128
+#define DGUS_TX_BUFFER_SIZE 48
+#define DGUS_UPDATE_INTERVAL_MS 500
+#define LCD_SERIAL_STATS_RX_BUFFER_OVERRUNS 1
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define FSTR_P const __FlashStringHelper *
+class __FlashStringHelper;
+#define FTOP(f) ((PGM_P)(f))
+#define FPSTR(p) ((FSTR_P)(p))
+#define F(s) FPSTR(PSTR(s))
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void * const *)(p))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+#define strncasecmp_P strncasecmp
+#define strstr_P strstr
+#define snprintf_P snprintf
+#include <strings.h>
+#define NUL_STR ""
+#define GET_TEXT(M) "text"
+#define LOOP_L_N(VAR, N) for (uint8_t VAR = 0; VAR < (N); VAR++)
+#define POW(a,b) powf(a,b)
+#define LROUND(x) lroundf(x)
+#define WITHIN(N,L,H) ((N) >= (L) && (N) <= (H))
+#define _MIN(a,b) ((a)<(b)?(a):(b))
+#define _MAX(a,b) ((a)>(b)?(a):(b))
+#define constrain(v,l,h) ((v)<(l)?(l):((v)>(h)?(h):(v)))
+#define UNUSED(x) ((void)(x))
+#define COUNT(a) (sizeof(a)/sizeof(*(a)))
+#define ZERO(a) memset(a,0,sizeof(a))
+#define NOLESS(v,n) do{ if ((v) < (n)) (v) = (n); }while(0)
+#define NOMORE(v,n) do{ if ((v) > (n)) (v) = (n); }while(0)
+#define ABS(a) ((a)<0?-(a):(a))
+#define SIGN(a) ((a>0)-(a<0))
+#define MMS_SCALED(x) (x)
+#define CRITICAL_SECTION_START() do{}while(0)
+#define CRITICAL_SECTION_END() do{}while(0)
+#define FORCE_INLINE inline __attribute__((always_inline))
+#define _BV(b) (1UL << (b))
+#define TEST(n,b) (!!((n) & _BV(b)))
+#define SBI(n,b) (n |= _BV(b))
+#define CBI(n,b) (n &= ~_BV(b))
+#define SET_BIT_TO(N,B,TF) do{ if (TF) SBI(N,B); else CBI(N,B); }while(0)
+
+typedef uint32_t millis_t;
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t);
+void idle();
+#define ELAPSED(NOW,SOON) (!PENDING(NOW,SOON))
+#define PENDING(NOW,SOON) ((int32_t)((NOW)-(SOON))<0)
+
+struct HostSerial {
+  void begin(long);
+  void end();
+  size_t write(uint8_t);
+  size_t write(const uint8_t *, size_t);
+  int read();
+  int peek();
+  int available();
+  int availableForWrite();
+  void flush();
+  void flushTX();
+  bool buffer_overruns();
+};
+extern HostSerial LCD_SERIAL;
+#define LCD_SERIAL_GET_TX_BUFFER_FREE() LCD_SERIAL.availableForWrite()
+
+#define DEBUG_ECHOPGM(...) do{}while(0)
+#define DEBUG_ECHOLNPGM(...) do{}while(0)
+#define DEBUG_ECHOPAIR_F(...) do{}while(0)
+#define DEBUG_ECHOLNPAIR_F(...) do{}while(0)
+#define DEBUG_ECHOLN() do{}while(0)
+#define SERIAL_ECHOPGM(...) do{}while(0)
+#define SERIAL_ECHOLNPGM(...) do{}while(0)
+#define SERIAL_ECHOPAIR(...) do{}while(0)
+#define SERIAL_ECHOLNPAIR(...) do{}while(0)
+#define SERIAL_ECHO_START() do{}while(0)
+#define SERIAL_EOL() do{}while(0)
+
+typedef float feedRate_t;
+typedef float const_float_t;
+struct xy_uint8_t { uint8_t x, y; };
+struct xyze_pos_t { float x, y, z, e; };
+extern xyze_pos_t current_position;
+extern feedRate_t feedrate_mm_s;
+extern int16_t feedrate_percentage;
+enum AxisEnum : uint8_t { X_AXIS, Y_AXIS, Z_AXIS, E_AXIS };
+struct Planner { static float get_axis_position_mm(AxisEnum); static xyze_pos_t position; };
+extern Planner planner;
+struct TempInfo { float celsius; int16_t target; };
+struct Temperature { static TempInfo temp_bed; static TempInfo temp_hotend[1]; };
+extern Temperature thermalManager;
+struct ProbeOff { float z; };
+struct Probe { static ProbeOff offset; };
+extern Probe probe;
+struct PrintStats { uint16_t totalPrints, finishedPrints; };
+struct PrintCounter { static uint32_t duration(); static PrintStats getStats(); static bool isRunning(); };
+extern PrintCounter print_job_timer;
+struct duration_t { duration_t(uint32_t); void toString(char *); };
+bool printingIsActive();
+bool printingIsPaused();
+#define IS_SD_PRINTING() false
+struct dir_t { uint8_t name[11]; uint8_t attributes; uint8_t reservedNT, creationTimeTenths; uint16_t creationTime, creationDate, lastAccessDate, firstClusterHigh, lastWriteTime, lastWriteDate, firstClusterLow; uint32_t fileSize; };
+#define DIR_NAME_DELETED 0xE5
+#define DIR_NAME_FREE 0x00
+#define DIR_ATT_HIDDEN 0x02
+#define DIR_ATT_DIRECTORY 0x10
+#define DIR_IS_SUBDIR(d) ((d)->attributes & DIR_ATT_DIRECTORY)
+#define DIR_IS_FILE_OR_SUBDIR(d) (((d)->attributes & 0x08) == 0)
+#define O_READ 0x01
+#define O_RDONLY O_READ
+#define O_WRITE 0x02
+#define O_RDWR (O_READ|O_WRITE)
+#define O_CREAT 0x10
+#define O_TRUNC 0x40
+#define LONG_FILENAME_LENGTH 66
+struct SdBaseFile {
+  bool open(SdBaseFile *dirFile, const char *path, uint8_t oflag);
+  bool close(); bool isOpen() const; bool sync(); bool remove();
+  int16_t read(void *buf, uint16_t nbyte); int16_t write(const void *buf, uint16_t nbyte);
+  bool seekSet(const uint32_t pos); uint32_t curPosition() const; uint32_t fileSize() const; void rewind();
+  int8_t readDir(dir_t *dir, char *longFilename);
+};
+struct SdFile : SdBaseFile {};
+struct CardReader { static void mount(); static void cdroot(); static bool isMounted(); static SdFile& getWorkDir(); };
+extern CardReader card;
+struct Stepper { static void enable_all_steppers(); static void disable_all_steppers(); };
+extern Stepper stepper;
+#define X_ENABLE_READ() 0
+#define Y_ENABLE_READ() 0
+#define Z_ENABLE_READ() 0
+#define X_ENABLE_ON 0
+#define Y_ENABLE_ON 0
+#define Z_ENABLE_ON 0
+extern uint8_t did_pause_print;
+enum PauseMode : char { PAUSE_MODE_SAME, PAUSE_MODE_PAUSE_PRINT, PAUSE_MODE_CHANGE_FILAMENT, PAUSE_MODE_LOAD_FILAMENT, PAUSE_MODE_UNLOAD_FILAMENT };
+enum PauseMessage : char { PAUSE_MESSAGE_PARKING, PAUSE_MESSAGE_CHANGING, PAUSE_MESSAGE_WAITING, PAUSE_MESSAGE_UNLOAD, PAUSE_MESSAGE_INSERT, PAUSE_MESSAGE_LOAD, PAUSE_MESSAGE_PURGE, PAUSE_MESSAGE_OPTION, PAUSE_MESSAGE_RESUME, PAUSE_MESSAGE_STATUS, PAUSE_MESSAGE_HEAT, PAUSE_MESSAGE_HEATING };
+enum PauseMenuResponse : char { PAUSE_RESPONSE_WAIT_FOR, PAUSE_RESPONSE_EXTRUDE_MORE, PAUSE_RESPONSE_RESUME_PRINT };
+extern PauseMode pause_mode;
+extern PauseMenuResponse pause_menu_response;
+extern bool wait_for_user;
+struct PrintJobRecovery { static bool valid(); };
+extern PrintJobRecovery recovery;
+struct GCodeQueue { static void enqueue_now_P(PGM_P); static bool enqueue_one_now(const char *); };
+extern GCodeQueue queue;
+struct MarlinSettings { static bool save(); static void reset(); static bool load(); };
+extern MarlinSettings settings;
+struct GcodeSuite { static void reset_stepper_timeout(); };
+extern GcodeSuite gcode;
+struct GCodeParser { static bool seen(char); static int value_int(); static bool seen_test(char); static bool boolval(char, bool=false); };
+extern GCodeParser parser;
+enum heater_id_t : int8_t { H_BED = -1, H_E0 = 0, H_E1 };
+enum probe_state_t { G29_POINT_FINISH };
+
+// The host side of LCD_SERIAL and the clock, driven by the tests (host.cpp)
+namespace Host {
+  extern millis_t now;
+  // Bytes the display "sends", read through LCD_SERIAL
+  void Receive(const uint8_t *data, size_t len);
+  // Bytes written to LCD_SERIAL since the last ClearSent()
+  extern uint8_t sent[1024];
+  extern size_t sent_len;
+  void ClearSent();
+}
+
+namespace ExtUI {
+  static constexpr size_t eeprom_data_size = 48;
+  enum axis_t : uint8_t { X, Y, Z };
+  enum extruder_t : uint8_t { E0, E1 };
+  enum heater_t : uint8_t { H0, H1, BED };
+  enum fan_t : uint8_t { FAN0 };
+  enum result_t : uint8_t { PID_STARTED, PID_DONE, PID_BAD_EXTRUDER_NUM, PID_TEMP_TOO_HIGH, PID_TUNING_TIMEOUT };
+  millis_t safe_millis();
+  bool isMoving(); bool commandsInQueue();
+  bool isAxisPositionKnown(axis_t); bool isPositionKnown();
+  float getAxisPosition_mm(axis_t); float getAxisPosition_mm(extruder_t);
+  void setAxisPosition_mm(float, axis_t); void setAxisPosition_mm(float, extruder_t);
+  bool getLevelingActive(); void setLevelingActive(bool); bool getMeshValid(); float getMeshPoint(xy_uint8_t);
+  uint8_t getProgress_percent(); float getFlow_percent(extruder_t); void setFlow_percent(float, extruder_t);
+  extruder_t getActiveTool(); void setFeedrate_percent(float);
+  int16_t mmToWholeSteps(float, axis_t); float getZOffset_mm(); void smartAdjustAxis_steps(int16_t, axis_t, bool);
+  void setTargetTemp_celsius(float, heater_t); void setTargetTemp_celsius(float, extruder_t); float getActualTemp_celsius(extruder_t);
+  float getTargetFan_percent(fan_t); float getActualFan_percent(fan_t); void setTargetFan_percent(float, fan_t);
+  void setFilamentRunoutEnabled(bool);
+  void printFile(const char *); void stopPrint(); void pausePrint(); void resumePrint(); void setUserConfirmed();
+  bool isMediaInserted();
+  float getBedPIDValues_Kp(); float getBedPIDValues_Ki(); float getBedPIDValues_Kd();
+  float getPIDValues_Kp(extruder_t); float getPIDValues_Ki(extruder_t); float getPIDValues_Kd(extruder_t);
+  void getTotalPrintTime_str(char *); void getLongestPrint_str(char *); void getFilamentUsed_str(char *);
+  float getAxisSteps_per_mm(axis_t); float getAxisSteps_per_mm(extruder_t); void setAxisSteps_per_mm(float, axis_t); void setAxisSteps_per_mm(float, extruder_t);
+  float getAxisMaxJerk_mm_s(axis_t); float getAxisMaxJerk_mm_s(extruder_t); void setAxisMaxJerk_mm_s(float, axis_t); void setAxisMaxJerk_mm_s(float, extruder_t);
+  float getJunctionDeviation_mm(); void setJunctionDeviation_mm(float);
+  float getLinearAdvance_mm_mm_s(extruder_t); void setLinearAdvance_mm_mm_s(float, extruder_t);
+  float getAxisMaxAcceleration_mm_s2(axis_t); float getAxisMaxAcceleration_mm_s2(extruder_t); void setAxisMaxAcceleration_mm_s2(float, axis_t); void setAxisMaxAcceleration_mm_s2(float, extruder_t);
+  float getPrintingAcceleration_mm_s2(); float getRetractAcceleration_mm_s2(); float getTravelAcceleration_mm_s2();
+  void setPrintingAcceleration_mm_s2(float); void setRetractAcceleration_mm_s2(float); void setTravelAcceleration_mm_s2(float);
+  feedRate_t getAxisMaxFeedrate_mm_s(axis_t); feedRate_t getAxisMaxFeedrate_mm_s(extruder_t); void setAxisMaxFeedrate_mm_s(feedRate_t, axis_t); void setAxisMaxFeedrate_mm_s(feedRate_t, extruder_t);
+  feedRate_t getMinFeedrate_mm_s(); feedRate_t getMinTravelFeedrate_mm_s(); void setMinFeedrate_mm_s(feedRate_t); void setMinTravelFeedrate_mm_s(feedRate_t);
+  class FileList {
+    public:
+      bool refresh(); bool seek(uint16_t, bool skip_range_check=false);
+      const char *longFilename(); const char *shortFilename(); const char *filename();
+      bool isDir(); void changeDir(const char *); void upDir(); bool isAtRootDir(); uint16_t count();
+  };
+  void onStartup(); void onIdle(); void onPrinterKilled(FSTR_P const, FSTR_P const);
+  void onMediaInserted(); void onMediaError(); void onMediaRemoved();
+  void onPlayTone(const uint16_t, const uint16_t); void onPrintTimerStarted(); void onPrintTimerPaused(); void onPrintTimerStopped();
+  void onFilamentRunout(const extruder_t); void onUserConfirmRequired(const char *const); void onStatusChanged(const char *const);
+  void onHomingStart(); void onHomingDone(); void onPrintDone(); void onFactoryReset(); void onStoreSettings(char *); void onLoadSettings(const char *);
+  void onPostprocessSettings(); void onConfigurationStoreWritten(bool); void onConfigurationStoreRead(bool);
+  void onLevelingStart(); void onLevelingDone(); void onMeshUpdate(const int8_t, const int8_t, const_float_t); void onMeshUpdate(const int8_t, const int8_t, const probe_state_t);
+  void onPowerLossResume(); void onPidTuning(const result_t); void onSteppersDisabled(); void onSteppersEnabled();
+}
+#define UI_INCREMENT_BY(A,B,C) ExtUI::set##A(ExtUI::get##A(C) + (B), C)
+#define UI_DECREMENT_BY(A,B,C) ExtUI::set##A(ExtUI::get##A(C) - (B), C)
@@ -0,0 +1,331 @@
+/**
+  * Marlin 3D Printer Firmware
+  * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+  *
+  * Based on Sprinter and grbl.
+  * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+  *
+  */
+
+/**
+ * Host tests of dgus_reloaded, see the Makefile. Returns non-zero on failure.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "inc/MarlinConfigPre.h"
+
+#include "DGUSDisplay.h"
+#include "DGUSScreenHandler.h"
+#include "DGUSRxHandler.h"
+#include "definition/DGUS_VPList.h"
+
+static uint8_t failures = 0;
+
+#define DGUS_CRC_LEN (ENABLED(DGUS_CRC) ? 2 : 0)
+
+#define DGUS_CHECK(C) do{ if (!(C)) { printf("%s:%d: %s failed\n", __FILE__, __LINE__, #C); failures++; } }while(0)
+
+// The display's answer to a read of one word. Returns the frame length.
+static uint8_t WordFrame(uint8_t *frame, const uint16_t addr, const uint16_t value) {
+  const uint8_t data[] = { 0x5A, 0xA5, uint8_t(6 + DGUS_CRC_LEN), 0x83, uint8_t(addr >> 8), uint8_t(addr), 1, uint8_t(value >> 8), uint8_t(value) };
+  memcpy(frame, data, sizeof(data));
+  #if ENABLED(DGUS_CRC)
+    const uint16_t crc = DGUSDisplay::CRC16(&frame[3], sizeof(data) - 3);
+    frame[sizeof(data)]     = crc & 0xFF;
+    frame[sizeof(data) + 1] = crc >> 8;
+  #endif
+  return sizeof(data) + DGUS_CRC_LEN;
+}
+
+static void ReceiveWord(const uint16_t addr, const uint16_t value) {
+  uint8_t frame[16];
+  Host::Receive(frame, WordFrame(frame, addr, value));
+}
+
+static uint8_t answers;
+static uint16_t answer;
+
+static void WordReceived(uint16_t addr, const uint8_t *data, uint8_t len) {
+  UNUSED(addr);
+  answers++;
+  answer = data && len == 2 ? data[0] << 8 | data[1] : 0xFFFF;
+}
+
+// An empty RXSTRING (just the 0xFFFF terminator) clears the text
+static void test_rxstring_empty() {
+  DGUS_VP vp;
+  DGUS_CHECK(DGUS_PopulateVP(DGUS_Addr::GCODE_Data, &vp));
+
+  strcpy(dgus_screen_handler.gcode, "G28");
+
+  uint8_t data[] = { 0xFF, 0xFF };
+  vp.size = 0; // Received length, as set by DGUSDisplay::ProcessDatagram
+  vp.rx_handler(vp, data);
+
+  DGUS_CHECK(dgus_screen_handler.gcode[0] == '\0');
+}
+
+// A received string replaces the text and is terminated
+static void test_rxstring_text() {
+  DGUS_VP vp;
+  DGUS_CHECK(DGUS_PopulateVP(DGUS_Addr::GCODE_Data, &vp));
+
+  strcpy(dgus_screen_handler.gcode, "G29 P1");
+
+  uint8_t data[] = { 'M', '1', '1', '9', 0xFF, 0xFF };
+  vp.size = 4;
+  vp.rx_handler(vp, data);
+
+  DGUS_CHECK(!strcmp(dgus_screen_handler.gcode, "M119"));
+}
+
+// Enough answers to go around the RX ring several times, so some wrap at its end
+static void test_rx_wrap() {
+  uint16_t wrong = 0;
+
+  LOOP_L_N(i, 100) {
+    answers = 0;
+    DGUS_CHECK(dgus_display.ReadAsync(0x1234, 1, WordReceived));
+    ReceiveWord(0x1234, 0x4000 + i);
+    dgus_display.Loop();
+
+    if (answers != 1 || answer != 0x4000 + i) wrong++;
+  }
+
+  DGUS_CHECK(!wrong);
+}
+
+// A frame that arrives in pieces is handled once it is complete
+static void test_rx_split() {
+  uint8_t frame[16];
+  const uint8_t len = WordFrame(frame, 0x1234, 0xBEEF);
+
+  LOOP_L_N(split, len) {
+    answers = 0;
+    DGUS_CHECK(dgus_display.ReadAsync(0x1234, 1, WordReceived));
+
+    Host::Receive(frame, split);
+    dgus_display.Loop();
+    DGUS_CHECK(answers == 0);
+
+    Host::Receive(&frame[split], len - split);
+    dgus_display.Loop();
+    DGUS_CHECK(answers == 1 && answer == 0xBEEF);
+  }
+}
+
+static bool nested_ok;
+
+// Gets back into Loop() while more than a ring full of data waits, as a handler calling idle() would
+static void NestedReceived(uint16_t addr, const uint8_t *data, uint8_t len) {
+  UNUSED(addr);
+  LOOP_L_N(i, 40) ReceiveWord(0x1235, 0x1111);
+  dgus_display.Loop();
+
+  nested_ok = len == 2 && data[0] == 0xCA && data[1] == 0xFE;
+}
+
+// A handler getting back into Loop() keeps its data
+static void test_rx_reentry() {
+  nested_ok = false;
+  DGUS_CHECK(dgus_display.ReadAsync(0x1234, 1, NestedReceived));
+  ReceiveWord(0x1234, 0xCAFE);
+  dgus_display.Loop();
+  DGUS_CHECK(nested_ok);
+
+  // The rest is handled afterwards
+  answers = 0;
+  DGUS_CHECK(dgus_display.ReadAsync(0x1235, 1, WordReceived));
+  LOOP_L_N(i, 10) dgus_display.Loop();
+  DGUS_CHECK(answers == 1 && answer == 0x1111);
+  LOOP_L_N(i, 10) dgus_display.Loop();
+}
+
+// A resync keeps a frame that is halfway in and does not report pending reads as missed
+static void test_resync() {
+  uint8_t frame[16];
+  const uint8_t len = WordFrame(frame, 0x1234, 0xBEEF);
+
+  answers = 0;
+  DGUS_CHECK(dgus_display.ReadAsync(0x1234, 1, WordReceived));
+  Host::Receive(frame, len / 2);
+  dgus_display.Loop();
+  dgus_display.Resync();
+  DGUS_CHECK(answers == 0);
+
+  DGUS_CHECK(dgus_display.ReadAsync(0x1234, 1, WordReceived));
+  Host::Receive(&frame[len / 2], len - len / 2);
+  dgus_display.Loop();
+  DGUS_CHECK(answers == 1 && answer == 0xBEEF);
+}
+
+#if DGUS_ACK_WINDOW && DGUS_SHADOW_SIZE
+
+  static void ReceiveAck() {
+    uint8_t frame[] = { 0x5A, 0xA5, uint8_t(3 + DGUS_CRC_LEN), 0x82, 'O', 'K', 0, 0 };
+    #if ENABLED(DGUS_CRC)
+      const uint16_t crc = DGUSDisplay::CRC16(&frame[3], 3);
+      frame[6] = crc & 0xFF;
+      frame[7] = crc >> 8;
+    #endif
+    Host::Receive(frame, frame[2] + 3);
+  }
+
+  // A write whose ACK never comes is sent again, not dropped as already shown
+  static void test_ack_timeout_resend() {
+    const uint16_t addr = 0x3000;
+
+    Host::ClearSent();
+    dgus_display.Write(addr, (uint16_t)1);
+    ReceiveAck();
+    dgus_display.Loop();
+    DGUS_CHECK(Host::sent_len);
+
+    // Acknowledged, so the display has it
+    Host::ClearSent();
+    dgus_display.Write(addr, (uint16_t)1);
+    DGUS_CHECK(!Host::sent_len);
+
+    // Lost
+    dgus_display.Write(addr, (uint16_t)2);
+    DGUS_CHECK(Host::sent_len);
+    Host::now += DGUS_ACK_TIMEOUT_MS;
+    dgus_display.Loop();
+    DGUS_CHECK(dgus_display.GetAckTimeouts() == 1);
+
+    Host::ClearSent();
+    dgus_display.Write(addr, (uint16_t)2);
+    DGUS_CHECK(Host::sent_len);
+
+    ReceiveAck();
+    dgus_display.Loop();
+  }
+
+#endif
+
+// Check value of the Modbus CRC16
+static void test_crc16() {
+  const char data[] = "123456789";
+  DGUS_CHECK(DGUSDisplay::CRC16((const uint8_t *)data, 9) == 0x4B37);
+
+  // Continued over two parts
+  DGUS_CHECK(DGUSDisplay::CRC16((const uint8_t *)data + 4, 5, DGUSDisplay::CRC16((const uint8_t *)data, 4)) == 0x4B37);
+}
+
+// The same CRC bit by bit, as it would be without the table
+static uint16_t CRC16Bitwise(const uint8_t *data, uint8_t len, uint16_t crc=0xFFFF) {
+  while (len--) {
+    crc ^= *data++;
+    LOOP_L_N(bit, 8) crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+  }
+  return crc;
+}
+
+// Time per largest frame: the length byte counts up to 255 bytes, 2 of them the CRC. Only
+// printed, host timings say little about the boards but show what the table saves.
+static void benchmark_crc16() {
+  uint8_t frame[255 - 2];
+  LOOP_L_N(i, sizeof(frame)) frame[i] = i * 7 + 1;
+
+  DGUS_CHECK(DGUSDisplay::CRC16(frame, sizeof(frame)) == CRC16Bitwise(frame, sizeof(frame)));
+
+  constexpr uint32_t rounds = 100000;
+  volatile uint16_t sink = 0;
+
+  const auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < rounds; i++) sink = sink + DGUSDisplay::CRC16(frame, sizeof(frame), sink);
+  const auto t1 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < rounds; i++) sink = sink + CRC16Bitwise(frame, sizeof(frame), sink);
+  const auto t2 = std::chrono::steady_clock::now();
+
+  const double table_us   = std::chrono::duration<double, std::micro>(t1 - t0).count() / rounds,
+               bitwise_us = std::chrono::duration<double, std::micro>(t2 - t1).count() / rounds;
+  printf("CRC16 of %u bytes: table %.3f us, bitwise %.3f us\n", (unsigned)sizeof(frame), table_us, bitwise_us);
+}
+
+static void LoadSettings(const uint8_t fill) {
+  char slot[ExtUI::eeprom_data_size];
+  memset(slot, fill, sizeof(slot));
+  dgus_screen_handler.LoadSettings(slot);
+}
+
+// Blank or random storage holds no settings, whatever its first bytes look like
+static void test_settings_blank() {
+  const uint8_t fills[] = { 0x00, 0xFF, 0x01, 0x32 };
+  for (const uint8_t fill : fills) {
+    dgus_display.SetVolume(13);
+    dgus_display.SetBrightness(13);
+    LoadSettings(fill);
+    DGUS_CHECK(dgus_display.GetVolume() == DGUS_DEFAULT_VOLUME);
+    DGUS_CHECK(dgus_display.GetBrightness() == DGUS_DEFAULT_BRIGHTNESS);
+  }
+}
+
+// What was stored is loaded, also after more changes than the log has records
+static void test_settings_roundtrip() {
+  char slot[ExtUI::eeprom_data_size];
+  LoadSettings(0xFF);
+
+  LOOP_L_N(i, 20) {
+    dgus_display.SetBrightness(50 + i);
+    dgus_screen_handler.StoreSettings(slot);
+  }
+
+  dgus_display.SetBrightness(10);
+  dgus_screen_handler.LoadSettings(slot);
+  DGUS_CHECK(dgus_display.GetBrightness() == 69);
+}
+
+// The layout before the settings log is migrated
+static void test_settings_legacy() {
+  char slot[ExtUI::eeprom_data_size] = { 1, 40, 60, 0 };
+  dgus_screen_handler.LoadSettings(slot);
+  DGUS_CHECK(dgus_display.GetVolume() == 40);
+  DGUS_CHECK(dgus_display.GetBrightness() == 60);
+}
+
+// After a kill nothing but ACKs is handled. Leaves the display in that state, so it runs last.
+static void test_killed_acks_only() {
+  answers = 0;
+  DGUS_CHECK(dgus_display.ReadAsync(0x1234, 1, WordReceived));
+  ReceiveWord(0x1234, 0x0BAD);
+  dgus_display.ProcessAcksOnly();
+  DGUS_CHECK(answers == 0);
+}
+
+int main() {
+  test_rxstring_empty();
+  test_rxstring_text();
+  test_rx_wrap();
+  test_rx_split();
+  test_rx_reentry();
+  #if DGUS_ACK_WINDOW && DGUS_SHADOW_SIZE
+    test_ack_timeout_resend();
+  #endif
+  test_resync();
+  test_crc16();
+  benchmark_crc16();
+  test_settings_blank();
+  test_settings_roundtrip();
+  test_settings_legacy();
+  test_killed_acks_only();
+
+  printf("%u failure(s)\n", failures);
+  return failures ? 1 : 0;
+}